@@ -0,0 +1,135 @@
+//
+// geomcpp benchmarks
+// Benchmark utilities.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+///////////////////
+
+// Measures the wall clock time that a given callable takes to run in seconds.
+template <typename Fn> double measureSeconds(Fn&& fn)
+{
+   const auto start = std::chrono::steady_clock::now();
+   fn();
+   const auto end = std::chrono::steady_clock::now();
+   return std::chrono::duration<double>(end - start).count();
+}
+
+
+// Prints a header for a table of benchmark results.
+inline void printBenchHeader(const std::string& title, const std::string& columns)
+{
+   std::cout << "\n" << title << "\n" << columns << "\n";
+}
+
+
+// Prints a benchmark result row consisting of a label and the measured time.
+inline void printBenchRow(const std::string& label, std::size_t n, double seconds)
+{
+   std::cout << std::left << std::setw(24) << label << std::right << std::setw(10) << n
+             << std::setw(14) << std::fixed << std::setprecision(4) << seconds
+             << std::setw(14) << std::setprecision(1)
+             << (n > 0 ? seconds * 1e9 / static_cast<double>(n) : 0.0) << "\n";
+}
+
+
+// Prints a benchmark result row consisting of a label, the measured time, and
+// the speedup relative to a baseline time.
+inline void printSpeedupRow(const std::string& label, double seconds, double baselineSeconds)
+{
+   std::cout << std::left << std::setw(24) << label << std::right << std::setw(14)
+             << std::fixed << std::setprecision(4) << seconds << std::setw(10)
+             << std::setprecision(2) << (seconds > 0 ? baselineSeconds / seconds : 0.0)
+             << "\n";
+}
+
+
+// Prints a benchmark result row consisting of a label, the measured time, and
+// a size in megabytes.
+inline void printMemoryRow(const std::string& label, double seconds, std::size_t bytes)
+{
+   std::cout << std::left << std::setw(24) << label << std::right << std::setw(14)
+             << std::fixed << std::setprecision(4) << seconds << std::setw(12)
+             << std::setprecision(1) << static_cast<double>(bytes) / (1024.0 * 1024.0)
+             << "\n";
+}
+
+
+///////////////////
+
+// Input generators. All generators are seeded to make runs comparable.
+
+// Uniformly distributed points in [0, extent] x [0, extent].
+template <typename T>
+std::vector<geom::Point2<T>> makeUniformPoints(std::size_t n, T extent,
+                                               unsigned int seed = 1234)
+{
+   std::mt19937 gen{seed};
+   std::uniform_real_distribution<T> dist{T(0), extent};
+
+   std::vector<geom::Point2<T>> points;
+   points.reserve(n);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const T x = dist(gen);
+      points.emplace_back(x, dist(gen));
+   }
+   return points;
+}
+
+
+// Points that are normally distributed around a given number of cluster centers
+// that are themselves uniformly distributed in [0, extent] x [0, extent].
+template <typename T>
+std::vector<geom::Point2<T>> makeClusteredPoints(std::size_t n, std::size_t numClusters,
+                                                 T extent, unsigned int seed = 1234)
+{
+   std::mt19937 gen{seed};
+   std::uniform_real_distribution<T> centerDist{T(0), extent};
+   std::normal_distribution<T> offsetDist{T(0), extent / T(100)};
+
+   std::vector<geom::Point2<T>> centers;
+   for (std::size_t i = 0; i < numClusters; ++i)
+   {
+      const T x = centerDist(gen);
+      centers.emplace_back(x, centerDist(gen));
+   }
+
+   std::vector<geom::Point2<T>> points;
+   points.reserve(n);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const geom::Point2<T>& center = centers[i % numClusters];
+      const T dx = offsetDist(gen);
+      points.emplace_back(center.x() + dx, center.y() + offsetDist(gen));
+   }
+   return points;
+}
+
+
+// Points on a regular grid with approximately n points.
+template <typename T> std::vector<geom::Point2<T>> makeGridPoints(std::size_t n, T spacing)
+{
+   const std::size_t dim =
+      static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n))));
+
+   std::vector<geom::Point2<T>> points;
+   points.reserve(dim * dim);
+   for (std::size_t r = 0; r < dim; ++r)
+      for (std::size_t c = 0; c < dim; ++c)
+         points.emplace_back(static_cast<T>(c) * spacing, static_cast<T>(r) * spacing);
+   return points;
+}
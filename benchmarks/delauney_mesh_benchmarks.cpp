@@ -0,0 +1,120 @@
+//
+// geomcpp benchmarks
+// Benchmarks for the Delauney triangle mesh.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_mesh_benchmarks.h"
+#include "bench_util.h"
+#include "delauney_mesh.h"
+#include "geom_util.h"
+#include "point2.h"
+#include "rect.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace geom;
+using Mesh = internals::DelauneyMesh<double>;
+
+
+namespace
+{
+///////////////////
+
+constexpr double Extent = 1000.0;
+
+
+// Prints the time and the triangle storage of a mesh per point.
+void printStorageRow(const std::string& label, std::size_t numPoints, double seconds,
+                     const Mesh& mesh)
+{
+   const double slots = static_cast<double>(mesh.numTriangleSlots());
+   const double n = static_cast<double>(numPoints);
+   std::cout << std::left << std::setw(24) << label << std::right << std::setw(10)
+             << numPoints << std::setw(14) << std::fixed << std::setprecision(4)
+             << seconds << std::setw(14) << std::setprecision(2) << slots / n
+             << std::setw(14) << std::setprecision(1)
+             << slots * sizeof(Mesh::MeshTriangle) / n << "\n";
+}
+
+
+// Sorts points along a Hilbert curve to keep the walks that locate them short.
+void sortSpatially(std::vector<Point2<double>>& points)
+{
+   const Rect<double> bounds{Point2<double>{0.0, 0.0}, Point2<double>{Extent, Extent}};
+   std::sort(points.begin(), points.end(), [&bounds](const auto& a, const auto& b) {
+      return hilbertIndex(a, bounds) < hilbertIndex(b, bounds);
+   });
+}
+
+
+Mesh makeMesh(std::size_t expectedNumPoints)
+{
+   Mesh mesh;
+   mesh.init(expectedNumPoints);
+   return mesh;
+}
+
+
+void benchmarkInsertion()
+{
+   printBenchHeader("Mesh insertion, uniform points",
+                    "points                   points      time [s]  slots per pt  "
+                    "bytes per pt");
+
+   for (std::size_t n = 1000; n <= 1000000; n *= 10)
+   {
+      std::vector<Point2<double>> points = makeUniformPoints<double>(n, Extent);
+      sortSpatially(points);
+
+      Mesh mesh = makeMesh(n);
+      const double seconds = measureSeconds([&]() {
+         for (const Point2<double>& pt : points)
+            mesh.insert(pt);
+      });
+      printStorageRow(std::to_string(n), n, seconds, mesh);
+   }
+}
+
+
+void benchmarkChurn()
+{
+   // Replaces each point of a triangulation with a new point, one at a time.
+   printBenchHeader("Mesh churn, remove and insert each point",
+                    "points                   points      time [s]  slots per pt  "
+                    "bytes per pt");
+
+   for (std::size_t n = 1000; n <= 100000; n *= 10)
+   {
+      std::vector<Point2<double>> points = makeUniformPoints<double>(n, Extent, 1);
+      std::vector<Point2<double>> replacements = makeUniformPoints<double>(n, Extent, 2);
+      sortSpatially(points);
+      sortSpatially(replacements);
+
+      Mesh mesh = makeMesh(2 * n);
+      for (const Point2<double>& pt : points)
+         mesh.insert(pt);
+
+      const double seconds = measureSeconds([&]() {
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            mesh.remove(points[i]);
+            mesh.insert(replacements[i]);
+         }
+      });
+      printStorageRow(std::to_string(n), n, seconds, mesh);
+   }
+}
+
+} // namespace
+
+
+void benchmarkDelauneyMesh()
+{
+   benchmarkInsertion();
+   benchmarkChurn();
+}
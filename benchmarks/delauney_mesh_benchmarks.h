@@ -0,0 +1,10 @@
+//
+// geomcpp benchmarks
+// Benchmarks for the Delauney triangle mesh.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void benchmarkDelauneyMesh();
@@ -0,0 +1,88 @@
+//
+// geomcpp benchmarks
+// Benchmarks for point location queries on Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_point_locator_benchmarks.h"
+#include "bench_util.h"
+#include "delauney_point_locator.h"
+#include "delauney_triangulation.h"
+#include "geom_util.h"
+#include "point2.h"
+#include "rect.h"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace geom;
+using Locator = DelauneyPointLocator<double>;
+
+
+namespace
+{
+///////////////////
+
+constexpr double Extent = 1000.0;
+
+
+// Sorts points along a Hilbert curve, so that consecutive queries are close
+// to each other.
+void sortSpatially(std::vector<Point2<double>>& points)
+{
+   const Rect<double> bounds{Point2<double>{0.0, 0.0}, Point2<double>{Extent, Extent}};
+   std::sort(points.begin(), points.end(), [&bounds](const auto& a, const auto& b) {
+      return hilbertIndex(a, bounds) < hilbertIndex(b, bounds);
+   });
+}
+
+
+void benchmarkQueries(const std::string& title, std::size_t numQueries)
+{
+   printBenchHeader(title, "queries                 queries     time [s]  ns per query");
+
+   for (std::size_t n = 1000; n <= 1000000; n *= 10)
+   {
+      const Locator locator{
+         DelauneyTriangulation<double>{makeUniformPoints<double>(n, Extent)}
+            .triangulateIndexed(true)};
+      std::vector<Point2<double>> queries =
+         makeUniformPoints<double>(numQueries, Extent, 4321);
+      std::vector<Locator::Idx> result;
+      const std::string suffix = " " + std::to_string(n);
+
+      double seconds = measureSeconds([&]() {
+         result.clear();
+         for (const auto& pt : queries)
+            result.push_back(locator.locate(pt));
+      });
+      printBenchRow("locate" + suffix, numQueries, seconds);
+
+      seconds = measureSeconds([&]() { locator.locate(queries, result); });
+      printBenchRow("batch" + suffix, numQueries, seconds);
+
+      seconds = measureSeconds([&]() {
+         result.clear();
+         for (const auto& pt : queries)
+            result.push_back(locator.nearestVertex(pt));
+      });
+      printBenchRow("nearest" + suffix, numQueries, seconds);
+
+      sortSpatially(queries);
+      seconds = measureSeconds([&]() { locator.locate(queries, result); });
+      printBenchRow("sorted batch" + suffix, numQueries, seconds);
+
+      seconds = measureSeconds([&]() { locator.nearestVertex(queries, result); });
+      printBenchRow("sorted nearest" + suffix, numQueries, seconds);
+   }
+}
+
+} // namespace
+
+
+void benchmarkDelauneyPointLocator()
+{
+   benchmarkQueries("Point location, 1M uniform queries", 1000000);
+}
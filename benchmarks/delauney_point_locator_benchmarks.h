@@ -0,0 +1,10 @@
+//
+// geomcpp benchmarks
+// Benchmarks for point location queries on Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void benchmarkDelauneyPointLocator();
@@ -0,0 +1,246 @@
+//
+// geomcpp benchmarks
+// Benchmarks for Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_triangulation_benchmarks.h"
+#include "bench_util.h"
+#include "delauney_triangulation.h"
+#include "delauney_workspace.h"
+#include "indexed_triangulation.h"
+#include "kinetic_delauney_triangulation.h"
+#include "point2.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+void benchmarkTriangulation(
+   const std::string& title, std::vector<Point2<double>> (*makePoints)(std::size_t),
+   DelauneyAlgorithm algorithm,
+   DelauneyInsertionOrder insertionOrder = DelauneyInsertionOrder::Strips,
+   std::size_t maxNumPoints = 1000000)
+{
+   printBenchHeader(title, "points                   points     time [s]  ns per point");
+
+   for (std::size_t n = 1000; n <= maxNumPoints; n *= 10)
+   {
+      const std::vector<Point2<double>> points = makePoints(n);
+      const double seconds = measureSeconds([&]() {
+         DelauneyTriangulation<double> dt{points, algorithm, 1, insertionOrder};
+         dt.triangulate();
+      });
+      printBenchRow(std::to_string(n), n, seconds);
+   }
+}
+
+
+void benchmarkParallelTriangulation(const std::string& title,
+                                    const std::vector<Point2<double>>& points)
+{
+   printBenchHeader(title, "threads                       time [s]   speedup");
+
+   const std::size_t maxThreads =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+   double serialSeconds = 0;
+   for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+   {
+      const double seconds = measureSeconds([&]() {
+         DelauneyTriangulation<double> dt{points, DelauneyAlgorithm::DivideAndConquer,
+                                          numThreads};
+         dt.triangulate();
+      });
+      if (numThreads == 1)
+         serialSeconds = seconds;
+      printSpeedupRow(std::to_string(numThreads), seconds, serialSeconds);
+   }
+}
+
+
+void benchmarkOutputFormats(const std::string& title, DelauneyAlgorithm algorithm,
+                            const std::vector<Point2<double>>& points)
+{
+   printBenchHeader(title, "output                        time [s]  size [MB]");
+
+   std::size_t bytes = 0;
+   double seconds = measureSeconds([&]() {
+      DelauneyTriangulation<double> dt{points, algorithm};
+      bytes = dt.triangulate().size() * sizeof(Triangle<double>);
+   });
+   printMemoryRow("triangles", seconds, bytes);
+
+   for (const bool withNeighbors : {false, true})
+   {
+      seconds = measureSeconds([&]() {
+         DelauneyTriangulation<double> dt{points, algorithm};
+         const IndexedTriangulation<double> indexed = dt.triangulateIndexed(withNeighbors);
+         bytes = indexed.vertices.size() * sizeof(Point2<double>) +
+                 (indexed.indices.size() + indexed.neighbors.size()) *
+                    sizeof(std::uint32_t);
+      });
+      printMemoryRow(withNeighbors ? "indexed with neighbors" : "indexed", seconds, bytes);
+   }
+}
+
+
+void benchmarkConditionCheck(const std::string& title,
+                             std::vector<Point2<double>> (*makePoints)(std::size_t),
+                             std::size_t maxNumPoints)
+{
+   printBenchHeader(title, "points                   points     time [s]  ns per point");
+
+   for (std::size_t n = 1000; n <= maxNumPoints; n *= 10)
+   {
+      DelauneyTriangulation<double> dt{makePoints(n)};
+      const std::vector<Triangle<double>> triangles = dt.triangulate();
+      const double seconds = measureSeconds([&]() {
+         DelauneyTriangulation<double>::isDelauneyConditionSatisfied(triangles);
+      });
+      printBenchRow(std::to_string(n), n, seconds);
+   }
+}
+
+
+void benchmarkSmallSets(const std::string& title, std::size_t numSets,
+                        std::size_t numPoints)
+{
+   printBenchHeader(title, "variant                       time [s]   speedup");
+
+   std::vector<std::vector<Point2<double>>> pointSets;
+   for (std::size_t i = 0; i < numSets; ++i)
+      pointSets.push_back(
+         makeUniformPoints<double>(numPoints, 1000.0, static_cast<unsigned int>(i)));
+
+   std::size_t numTriangles = 0;
+   const double instanceSeconds = measureSeconds([&]() {
+      for (const auto& points : pointSets)
+         numTriangles += DelauneyTriangulation<double>{points}.triangulate().size();
+   });
+   printSpeedupRow("instance per set", instanceSeconds, instanceSeconds);
+
+   DelauneyWorkspace<double> workspace;
+   const double workspaceSeconds = measureSeconds([&]() {
+      for (const auto& points : pointSets)
+         numTriangles += workspace.triangulate(points).size();
+   });
+   printSpeedupRow("workspace", workspaceSeconds, instanceSeconds);
+}
+
+
+void benchmarkMovingPoints(const std::string& title, std::size_t numPoints,
+                           std::size_t numSteps)
+{
+   printBenchHeader(title, "variant                       time [s]   speedup");
+
+   // Average distance between neighboring points.
+   const double extent = 1000.0;
+   const double spacing = extent / std::sqrt(static_cast<double>(numPoints));
+
+   for (const double stepSize : {0.01, 0.1, 0.5})
+   {
+      // Move each point by up to the step size times the spacing per step.
+      const std::vector<Point2<double>> start =
+         makeUniformPoints<double>(numPoints, extent);
+      std::vector<std::vector<Point2<double>>> steps{start};
+      std::mt19937 gen{4321};
+      std::uniform_real_distribution<double> dist{-stepSize * spacing,
+                                                  stepSize * spacing};
+      for (std::size_t i = 0; i < numSteps; ++i)
+      {
+         std::vector<Point2<double>> next = steps.back();
+         for (Point2<double>& pt : next)
+         {
+            const double dx = dist(gen);
+            pt = {pt.x() + dx, pt.y() + dist(gen)};
+         }
+         steps.push_back(std::move(next));
+      }
+
+      std::size_t numTriangles = 0;
+      const double rebuildSeconds = measureSeconds([&]() {
+         for (std::size_t i = 1; i <= numSteps; ++i)
+            numTriangles += DelauneyTriangulation<double>{steps[i]}.triangulate().size();
+      });
+
+      KineticDelauneyTriangulation<double> kinetic{start};
+      const double updateSeconds = measureSeconds([&]() {
+         for (std::size_t i = 1; i <= numSteps; ++i)
+            kinetic.update(steps[i]);
+      });
+
+      const std::string label = std::to_string(static_cast<int>(stepSize * 100)) + "%";
+      printSpeedupRow("rebuild, step " + label, rebuildSeconds, rebuildSeconds);
+      printSpeedupRow("update, step " + label, updateSeconds, rebuildSeconds);
+   }
+}
+
+
+std::vector<Point2<double>> makeUniform(std::size_t n)
+{
+   return makeUniformPoints<double>(n, 1000.0);
+}
+
+
+std::vector<Point2<double>> makeClustered(std::size_t n)
+{
+   return makeClusteredPoints<double>(n, 10, 1000.0);
+}
+
+
+std::vector<Point2<double>> makeGridded(std::size_t n)
+{
+   return makeGridPoints<double>(n, 1.0);
+}
+
+} // namespace
+
+
+void benchmarkDelauneyTriangulation()
+{
+   benchmarkTriangulation("Bowyer-Watson, uniform points", makeUniform,
+                          DelauneyAlgorithm::BowyerWatson);
+   benchmarkTriangulation("Bowyer-Watson, clustered points", makeClustered,
+                          DelauneyAlgorithm::BowyerWatson);
+   benchmarkTriangulation("Divide-and-conquer, uniform points", makeUniform,
+                          DelauneyAlgorithm::DivideAndConquer);
+   benchmarkTriangulation("Divide-and-conquer, clustered points", makeClustered,
+                          DelauneyAlgorithm::DivideAndConquer);
+   // Strip order degrades on grids because each point that starts a new column
+   // invalidates a long fan of triangles. Limit the size to keep the runtime
+   // reasonable.
+   benchmarkTriangulation("Bowyer-Watson, gridded points", makeGridded,
+                          DelauneyAlgorithm::BowyerWatson, DelauneyInsertionOrder::Strips,
+                          100000);
+   benchmarkTriangulation("Bowyer-Watson BRIO order, clustered points", makeClustered,
+                          DelauneyAlgorithm::BowyerWatson, DelauneyInsertionOrder::Brio);
+   benchmarkTriangulation("Bowyer-Watson BRIO order, gridded points", makeGridded,
+                          DelauneyAlgorithm::BowyerWatson, DelauneyInsertionOrder::Brio);
+   // The check tests each vertex against each triangle. Limit the size to keep
+   // the runtime reasonable.
+   benchmarkConditionCheck("Delauney condition check, uniform points", makeUniform,
+                           1000000);
+   benchmarkConditionCheck("Delauney condition check, clustered points",
+                           makeClustered, 1000000);
+   benchmarkSmallSets("Bowyer-Watson, 10000 sets of 100 uniform points", 10000, 100);
+   // Step sizes are relative to the average distance between points.
+   benchmarkMovingPoints("Moving points, 10 steps of 100000 uniform points", 100000, 10);
+   benchmarkParallelTriangulation("Parallel divide-and-conquer, 1M uniform points",
+                                  makeUniform(1000000));
+   benchmarkOutputFormats("Bowyer-Watson output formats, 1M uniform points",
+                          DelauneyAlgorithm::BowyerWatson, makeUniform(1000000));
+   benchmarkOutputFormats("Divide-and-conquer output formats, 1M uniform points",
+                          DelauneyAlgorithm::DivideAndConquer, makeUniform(1000000));
+}
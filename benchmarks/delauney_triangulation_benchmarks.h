@@ -0,0 +1,10 @@
+//
+// geomcpp benchmarks
+// Benchmarks for Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void benchmarkDelauneyTriangulation();
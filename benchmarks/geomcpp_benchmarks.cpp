@@ -0,0 +1,26 @@
+//
+// geomcpp benchmarks
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_mesh_benchmarks.h"
+#include "delauney_point_locator_benchmarks.h"
+#include "delauney_triangulation_benchmarks.h"
+#include "point_welder_benchmarks.h"
+#include "voronoi_tesselation_benchmarks.h"
+#include <cstdlib>
+#include <iostream>
+
+
+int main()
+{
+   benchmarkDelauneyMesh();
+   benchmarkDelauneyTriangulation();
+   benchmarkDelauneyPointLocator();
+   benchmarkPointWelder();
+   benchmarkVoronoiTesselation();
+
+   std::cout << "\ngeomcpp benchmarks finished.\n";
+   return EXIT_SUCCESS;
+}
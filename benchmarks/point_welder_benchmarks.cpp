@@ -0,0 +1,75 @@
+//
+// geomcpp benchmarks
+// Benchmarks for welding of points.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "point_welder_benchmarks.h"
+#include "bench_util.h"
+#include "point2.h"
+#include "point_welder.h"
+#include <cstddef>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+constexpr double Extent = 1000.0;
+
+
+// Uniform points of which every fifth is a copy of an earlier point.
+std::vector<Point2<double>> makePointsWithDuplicates(std::size_t n)
+{
+   std::vector<Point2<double>> points = makeUniformPoints<double>(n, Extent);
+   for (std::size_t i = 5; i < n; i += 5)
+      points[i] = points[i / 2];
+   return points;
+}
+
+
+void benchmarkDeduplication(const std::string& title)
+{
+   const std::size_t numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+   printBenchHeader(title, "method                         time [s]   speedup");
+
+   for (std::size_t n = 10000; n <= 1000000; n *= 10)
+   {
+      const std::vector<Point2<double>> points = makePointsWithDuplicates(n);
+      const std::string suffix = " " + std::to_string(n);
+      std::cout << "\n";
+
+      const double setSeconds = measureSeconds([&]() {
+         const std::set<Point2<double>, pointLess<double>> unique(points.begin(),
+                                                                  points.end());
+      });
+      printSpeedupRow("std::set" + suffix, setSeconds, setSeconds);
+
+      WeldedPoints<double> welded;
+      double seconds =
+         measureSeconds([&]() { welded = PointWelder<double>::weld(points); });
+      printSpeedupRow("welder" + suffix, seconds, setSeconds);
+
+      seconds = measureSeconds([&]() {
+         welded = PointWelder<double>::weld(points, PointWelder<double>::DefaultTolerance,
+                                            numThreads);
+      });
+      printSpeedupRow("welder mt" + suffix, seconds, setSeconds);
+   }
+}
+
+} // namespace
+
+
+void benchmarkPointWelder()
+{
+   benchmarkDeduplication("Removing duplicates, uniform points with 20% duplicates");
+}
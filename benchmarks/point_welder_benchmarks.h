@@ -0,0 +1,10 @@
+//
+// geomcpp benchmarks
+// Benchmarks for welding of points.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void benchmarkPointWelder();
@@ -0,0 +1,197 @@
+//
+// geomcpp benchmarks
+// Benchmarks for Voronoi tesselation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "voronoi_tesselation_benchmarks.h"
+#include "bench_util.h"
+#include "point2.h"
+#include "poisson_disc_sampling.h"
+#include "rect.h"
+#include "voronoi_diagram.h"
+#include "voronoi_tesselation.h"
+#include "voronoi_tile.h"
+#include "voronoi_tile_locator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+constexpr double Extent = 1000.0;
+
+
+void benchmarkTesselation(const std::string& title,
+                          std::vector<Point2<double>> (*makePoints)(std::size_t),
+                          std::size_t maxNumPoints = 5000000)
+{
+   printBenchHeader(title, "engine                   sites     time [s]   ns per site");
+
+   const Rect<double> border{0.0, 0.0, Extent, Extent};
+   for (const std::size_t n : {10000, 100000, 1000000, 5000000})
+   {
+      if (n > maxNumPoints)
+         break;
+
+      const std::vector<Point2<double>> points = makePoints(n);
+      for (const auto algorithm :
+           {VoronoiAlgorithm::DelauneyDual, VoronoiAlgorithm::Fortune})
+      {
+         const double seconds = measureSeconds([&]() {
+            VoronoiTesselation<double> vt{points, border, algorithm};
+            vt.tesselate();
+         });
+         const std::string label =
+            algorithm == VoronoiAlgorithm::Fortune ? "fortune" : "delauney dual";
+         printBenchRow(label, points.size(), seconds);
+      }
+   }
+}
+
+
+void benchmarkParallelTesselation(const std::string& title, VoronoiAlgorithm algorithm,
+                                  const std::vector<Point2<double>>& points)
+{
+   printBenchHeader(title, "threads                       time [s]   speedup");
+
+   const Rect<double> border{0.0, 0.0, Extent, Extent};
+   const std::size_t maxThreads =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+   double serialSeconds = 0;
+   for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+   {
+      const double seconds = measureSeconds([&]() {
+         VoronoiTesselation<double> vt{points, border, algorithm, numThreads};
+         vt.tesselate();
+      });
+      if (numThreads == 1)
+         serialSeconds = seconds;
+      printSpeedupRow(std::to_string(numThreads), seconds, serialSeconds);
+   }
+}
+
+
+void benchmarkOutputFormats(const std::string& title, VoronoiAlgorithm algorithm,
+                            const std::vector<Point2<double>>& points)
+{
+   printBenchHeader(title, "output                        time [s]  size [MB]");
+
+   const Rect<double> border{0.0, 0.0, Extent, Extent};
+   std::size_t bytes = 0;
+   double seconds = measureSeconds([&]() {
+      VoronoiTesselation<double> vt{points, border, algorithm};
+      const std::vector<VoronoiTile<double>> tiles = vt.tesselate();
+      // Lower bound. Each outline is a separate allocation with its own
+      // overhead.
+      bytes = tiles.size() * sizeof(VoronoiTile<double>);
+      for (const auto& tile : tiles)
+         bytes += tile.outline().size() * sizeof(Point2<double>);
+   });
+   printMemoryRow("tiles", seconds, bytes);
+
+   seconds = measureSeconds([&]() {
+      VoronoiTesselation<double> vt{points, border, algorithm};
+      const VoronoiDiagram<double> diagram = vt.tesselateIndexed();
+      bytes = (diagram.sites.size() + diagram.vertices.size()) * sizeof(Point2<double>) +
+              diagram.edges.size() * sizeof(VoronoiDiagram<double>::Edge) +
+              (diagram.firstCellEdge.size() + diagram.cellEdges.size()) *
+                 sizeof(std::uint32_t);
+   });
+   printMemoryRow("diagram", seconds, bytes);
+}
+
+
+void benchmarkTileQueries(const std::string& title, std::size_t numQueries)
+{
+   printBenchHeader(title, "queries                 queries     time [s]  ns per query");
+
+   const Rect<double> border{0.0, 0.0, Extent, Extent};
+   const std::size_t maxThreads =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+   for (std::size_t n = 1000; n <= 1000000; n *= 10)
+   {
+      const std::vector<VoronoiTile<double>> tiles =
+         VoronoiTesselation<double>{makeUniformPoints<double>(n, Extent), border}
+            .tesselate();
+      const std::string suffix = " " + std::to_string(n);
+
+      double seconds = measureSeconds([&]() { VoronoiTileLocator<double>{tiles}; });
+      printBenchRow("build" + suffix, tiles.size(), seconds);
+
+      const VoronoiTileLocator<double> locator{tiles};
+      const std::vector<Point2<double>> queries =
+         makeUniformPoints<double>(numQueries, Extent, 4321);
+      std::vector<VoronoiTileLocator<double>::Idx> result;
+
+      seconds = measureSeconds([&]() {
+         result.clear();
+         for (const auto& pt : queries)
+            result.push_back(locator.findTile(pt));
+      });
+      printBenchRow("find" + suffix, numQueries, seconds);
+
+      for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+      {
+         seconds =
+            measureSeconds([&]() { locator.findTiles(queries, result, numThreads); });
+         printBenchRow("batch " + std::to_string(numThreads) + "t" + suffix, numQueries,
+                       seconds);
+      }
+   }
+}
+
+
+std::vector<Point2<double>> makeUniform(std::size_t n)
+{
+   return makeUniformPoints<double>(n, Extent);
+}
+
+
+std::vector<Point2<double>> makeClustered(std::size_t n)
+{
+   // Clusters can extend past the border.
+   return makeClusteredPoints<double>(n, 10, Extent);
+}
+
+
+std::vector<Point2<double>> makePoissonDisc(std::size_t n)
+{
+   // Bridson's algorithm covers about 2.9 squared min distances per sample.
+   const double minDist = Extent * std::sqrt(1.0 / (2.9 * static_cast<double>(n)));
+   sutil::Random<double> rand{0.0, 1.0, 1234};
+   PoissonDiscSampling<double> sampling{Rect<double>{0.0, 0.0, Extent, Extent}, minDist,
+                                        PoissonDiscSampling<double>::NumCandidatesDefault,
+                                        rand};
+   return sampling.generate();
+}
+
+} // namespace
+
+
+void benchmarkVoronoiTesselation()
+{
+   benchmarkTesselation("Voronoi tesselation, uniform points", makeUniform);
+   benchmarkTesselation("Voronoi tesselation, clustered points", makeClustered);
+   benchmarkTesselation("Voronoi tesselation, Poisson disc points", makePoissonDisc);
+   // Only building the tiles is split across the threads.
+   benchmarkParallelTesselation("Parallel Delauney dual, 1M uniform points",
+                                VoronoiAlgorithm::DelauneyDual, makeUniform(1000000));
+   benchmarkParallelTesselation("Parallel Fortune tiles, 1M uniform points",
+                                VoronoiAlgorithm::Fortune, makeUniform(1000000));
+   benchmarkOutputFormats("Delauney dual output formats, 1M uniform points",
+                          VoronoiAlgorithm::DelauneyDual, makeUniform(1000000));
+   benchmarkOutputFormats("Fortune output formats, 1M uniform points",
+                          VoronoiAlgorithm::Fortune, makeUniform(1000000));
+   benchmarkTileQueries("Voronoi tile queries, 1M uniform queries", 1000000);
+}
@@ -0,0 +1,225 @@
+//
+// geomcpp
+// Constrained Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_mesh.h"
+#include "delauney_stats.h"
+#include "delauney_triangulation.h"
+#include "indexed_triangulation.h"
+#include "line_seg2_ct.h"
+#include "point2.h"
+#include "triangle.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Parts of a constrained triangulation that are returned.
+enum class ConstrainedRegion
+{
+   // All triangles inside the convex hull of the points.
+   ConvexHull,
+   // Triangles that are enclosed by the segments. A triangle is enclosed when
+   // reaching it from outside of the hull requires crossing an odd number of
+   // segments. For closed polygons this selects their interior. Holes are
+   // excluded and islands in holes are included again.
+   Enclosed
+};
+
+
+///////////////////
+
+// Delauney triangulation that contains given segments as edges, e.g. polygon
+// boundaries or roads. The triangles are Delauney except where a segment
+// blocks the view between their points.
+// The points are triangulated first. Then each segment is inserted into the
+// mesh by removing the triangles that it crosses and triangulating the
+// polygons on both sides of it again. Segments that cross each other are split
+// at a new point at their intersection. Points that lie on a segment split it
+// as well.
+// The endpoints of the segments are part of the triangulation. They are taken
+// from the segments' start and end points, so segments that share an endpoint
+// should be created from the same point coordinates.
+template <typename T> class ConstrainedDelauneyTriangulation
+{
+ public:
+   // Exact duplicate points are ignored. Degenerate segments are treated as
+   // points.
+   ConstrainedDelauneyTriangulation(std::vector<Point2<T>> samples,
+                                    std::vector<ct::LineSeg2<T>> segments);
+
+   // Starts the constrained triangulation.
+   std::vector<Triangle<T>>
+   triangulate(ConstrainedRegion region = ConstrainedRegion::ConvexHull);
+   // Starts the constrained triangulation and returns the result as vertex and
+   // index buffers. Optionally, includes the neighbors of each triangle.
+   // Neighbors outside of the region are stored as NoNeighbor.
+   IndexedTriangulation<T>
+   triangulateIndexed(bool withNeighbors = false,
+                      ConstrainedRegion region = ConstrainedRegion::ConvexHull);
+
+   // Returns the indices of the segments that could not be inserted completely
+   // by the last triangulation. This happens when their endpoints cannot be
+   // found in the mesh or when rounded intersections keep them from being
+   // connected. The triangulation is still returned but lacks these segments
+   // as edges, so an enclosed region might be wrong.
+   const std::vector<std::size_t>& failedSegments() const { return m_failedSegments; }
+   // Returns statistics about the insertion of the points. Only collected when
+   // GEOM_DELAUNEY_STATS is defined.
+   const DelauneyStats& stats() const { return m_mesh.stats(); }
+
+ private:
+   using VertexIdx = typename internals::DelauneyMesh<T>::VertexIdx;
+   using TriangleIdx = typename internals::DelauneyMesh<T>::TriangleIdx;
+   static constexpr std::uint32_t NoIdx = internals::DelauneyMesh<T>::NoIdx;
+
+   // Inserts the points and segments into the mesh. Returns false if there is
+   // nothing to triangulate.
+   bool run();
+   // Marks the triangles of a region in m_selection. Returns nullptr when all
+   // triangles are selected.
+   const std::vector<char>* select(ConstrainedRegion region);
+
+ private:
+   std::vector<Point2<T>> m_samples;
+   std::vector<ct::LineSeg2<T>> m_segments;
+   internals::DelauneyMesh<T> m_mesh;
+   std::vector<std::size_t> m_failedSegments;
+   // Selected triangle slots of the mesh.
+   std::vector<char> m_selection;
+};
+
+
+template <typename T>
+ConstrainedDelauneyTriangulation<T>::ConstrainedDelauneyTriangulation(
+   std::vector<Point2<T>> samples, std::vector<ct::LineSeg2<T>> segments)
+: m_samples{std::move(samples)}, m_segments{std::move(segments)}
+{
+   m_samples.reserve(m_samples.size() + 2 * m_segments.size());
+   for (const auto& seg : m_segments)
+   {
+      m_samples.push_back(*seg.startPoint());
+      m_samples.push_back(*seg.endPoint());
+   }
+   DelauneyTriangulation<T>::sortForInsertion(m_samples, DelauneyInsertionOrder::Strips);
+}
+
+
+template <typename T>
+std::vector<Triangle<T>>
+ConstrainedDelauneyTriangulation<T>::triangulate(ConstrainedRegion region)
+{
+   std::vector<Triangle<T>> result;
+   if (run())
+      m_mesh.triangles(result, select(region));
+   return result;
+}
+
+
+template <typename T>
+IndexedTriangulation<T>
+ConstrainedDelauneyTriangulation<T>::triangulateIndexed(bool withNeighbors,
+                                                        ConstrainedRegion region)
+{
+   IndexedTriangulation<T> result;
+   if (run())
+      m_mesh.indexedTriangles(withNeighbors, result, select(region));
+   return result;
+}
+
+
+template <typename T> bool ConstrainedDelauneyTriangulation<T>::run()
+{
+   m_mesh.init(m_samples.size());
+   m_failedSegments.clear();
+   for (const Point2<T>& sample : m_samples)
+      m_mesh.insert(sample);
+   // Without triangles the points are collinear or too few. The segments are
+   // edges of the mesh then.
+   if (!m_mesh.hasTriangles())
+      return false;
+
+   for (std::size_t i = 0; i < m_segments.size(); ++i)
+   {
+      const VertexIdx a = m_mesh.vertexAt(*m_segments[i].startPoint());
+      const VertexIdx b = m_mesh.vertexAt(*m_segments[i].endPoint());
+      // Splitting other segments at an intersection can lose them, too.
+      const std::size_t numLost = m_mesh.numLostConstraints();
+      if (a == NoIdx || b == NoIdx || !m_mesh.insertSegment(a, b) ||
+          m_mesh.numLostConstraints() != numLost)
+      {
+         m_failedSegments.push_back(i);
+      }
+   }
+   return true;
+}
+
+
+template <typename T>
+const std::vector<char>*
+ConstrainedDelauneyTriangulation<T>::select(ConstrainedRegion region)
+{
+   if (region == ConstrainedRegion::ConvexHull)
+      return nullptr;
+
+   // Count the segments that have to be crossed to reach each triangle from
+   // outside of the hull. Breadth-first search that visits triangles reached
+   // without crossing a segment before the others (0-1 BFS), so each triangle
+   // gets the smallest count.
+   const std::size_t numSlots = m_mesh.numTriangleSlots();
+   std::vector<std::size_t> numCrossings(numSlots,
+                                         std::numeric_limits<std::size_t>::max());
+   std::deque<TriangleIdx> queue;
+   for (TriangleIdx idx = 0; idx < numSlots; ++idx)
+   {
+      if (!m_mesh.isRemoved(idx) && m_mesh.isGhost(idx))
+      {
+         numCrossings[idx] = 0;
+         queue.push_back(idx);
+      }
+   }
+
+   while (!queue.empty())
+   {
+      const TriangleIdx idx = queue.front();
+      queue.pop_front();
+
+      const auto& t = m_mesh.triangle(idx);
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         const TriangleIdx neighbor = t.neighbors[i];
+         if (m_mesh.isGhost(neighbor))
+            continue;
+
+         const bool isCrossing =
+            m_mesh.isConstrained(t.vertices[(i + 1) % 3], t.vertices[(i + 2) % 3]);
+         const std::size_t count = numCrossings[idx] + (isCrossing ? 1 : 0);
+         if (count >= numCrossings[neighbor])
+            continue;
+
+         numCrossings[neighbor] = count;
+         if (isCrossing)
+            queue.push_back(neighbor);
+         else
+            queue.push_front(neighbor);
+      }
+   }
+
+   m_selection.assign(numSlots, false);
+   for (TriangleIdx idx = 0; idx < numSlots; ++idx)
+      m_selection[idx] = !m_mesh.isRemoved(idx) && numCrossings[idx] % 2 == 1;
+   return &m_selection;
+}
+
+} // namespace geom
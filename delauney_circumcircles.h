@@ -0,0 +1,152 @@
+//
+// geomcpp
+// Cached circumcircles of Delauney triangles.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace geom
+{
+namespace internals
+{
+///////////////////
+
+// Position of a point relative to a cached circumcircle.
+enum class CircleSide : std::int8_t
+{
+   // Strictly outside or on the circle.
+   Outside = -1,
+   // Too close to the circle to decide from the cached data. The exact in-circle
+   // predicate has to decide.
+   Unknown = 0,
+   // Strictly inside the circle.
+   Inside = 1
+};
+
+
+// Circumcircles of triangles stored in a structure-of-arrays layout.
+// Each circle is stored as its center and two thresholds for the squared
+// distance of a point from the center. Points that are closer than the inner
+// threshold are certainly inside, points that are farther than the outer
+// threshold are certainly outside of the exact circle. The thresholds account
+// for the rounding errors of calculating the circle and the distance. Points
+// between the thresholds need to be tested with the exact predicate.
+template <typename T> class CircumcircleCache
+{
+ public:
+   void clear();
+   void reserve(std::size_t n);
+   std::size_t size() const { return m_centerX.size(); }
+
+   // Calculates and appends the circumcircle of the triangle with given vertices.
+   void add(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c);
+
+   // Finds the position of a given point relative to the circle at a given index.
+   CircleSide side(std::size_t idx, const Point2<T>& pt) const;
+   Point2<T> center(std::size_t idx) const { return {m_centerX[idx], m_centerY[idx]}; }
+   // Returns a radius that is at least as large as the exact radius of the circle
+   // at a given index. Infinite for degenerate triangles.
+   T outerRadius(std::size_t idx) const { return std::sqrt(m_outerDistSquared[idx]); }
+
+ private:
+   std::vector<T> m_centerX;
+   std::vector<T> m_centerY;
+   std::vector<T> m_innerDistSquared;
+   std::vector<T> m_outerDistSquared;
+};
+
+
+template <typename T> void CircumcircleCache<T>::clear()
+{
+   m_centerX.clear();
+   m_centerY.clear();
+   m_innerDistSquared.clear();
+   m_outerDistSquared.clear();
+}
+
+
+template <typename T> void CircumcircleCache<T>::reserve(std::size_t n)
+{
+   m_centerX.reserve(n);
+   m_centerY.reserve(n);
+   m_innerDistSquared.reserve(n);
+   m_outerDistSquared.reserve(n);
+}
+
+
+template <typename T>
+void CircumcircleCache<T>::add(const Point2<T>& a, const Point2<T>& b,
+                               const Point2<T>& c)
+{
+   // Calculate the center relative to vertex a to reduce cancellation.
+   const T bx = b.x() - a.x();
+   const T by = b.y() - a.y();
+   const T cx = c.x() - a.x();
+   const T cy = c.y() - a.y();
+   const T bLift = bx * bx + by * by;
+   const T cLift = cx * cx + cy * cy;
+   const T det = T(2) * (bx * cy - by * cx);
+
+   // Degenerate triangles never decide from the cached data.
+   if (det == T(0) || !std::isfinite(det))
+   {
+      m_centerX.push_back(a.x());
+      m_centerY.push_back(a.y());
+      m_innerDistSquared.push_back(-std::numeric_limits<T>::infinity());
+      m_outerDistSquared.push_back(std::numeric_limits<T>::infinity());
+      return;
+   }
+
+   const T ux = (cy * bLift - by * cLift) / det;
+   const T uy = (bx * cLift - cx * bLift) / det;
+   const T radius = std::sqrt(ux * ux + uy * uy);
+
+   // Generous first-order bound of the error of each center coordinate. It
+   // combines the errors of the numerators, of the determinant, and of moving
+   // the center back from vertex a. The exact predicate catches everything
+   // inside the bound, so overestimating only costs performance.
+   constexpr T eps = std::numeric_limits<T>::epsilon() / 2;
+   const T numerators = std::abs(cy) * bLift + std::abs(by) * cLift +
+                        std::abs(bx) * cLift + std::abs(cx) * bLift;
+   const T permanent = std::abs(bx * cy) + std::abs(by * cx);
+   const T centerError =
+      T(16) * eps * (numerators + (std::abs(ux) + std::abs(uy)) * permanent) /
+         std::abs(det) +
+      T(4) * eps * (std::abs(a.x()) + std::abs(a.y()) + std::abs(ux) + std::abs(uy));
+   // The error of the distance from the center and of the radius.
+   const T distError = T(3) * centerError;
+
+   const T inner = std::max(radius - distError, T(0));
+   const T outer = radius + distError;
+   m_centerX.push_back(a.x() + ux);
+   m_centerY.push_back(a.y() + uy);
+   m_innerDistSquared.push_back(inner * inner * (T(1) - T(16) * eps));
+   m_outerDistSquared.push_back(outer * outer * (T(1) + T(16) * eps));
+}
+
+
+template <typename T>
+CircleSide CircumcircleCache<T>::side(std::size_t idx, const Point2<T>& pt) const
+{
+   const T dx = pt.x() - m_centerX[idx];
+   const T dy = pt.y() - m_centerY[idx];
+   const T distSquared = dx * dx + dy * dy;
+   if (distSquared < m_innerDistSquared[idx])
+      return CircleSide::Inside;
+   if (distSquared > m_outerDistSquared[idx])
+      return CircleSide::Outside;
+   return CircleSide::Unknown;
+}
+
+} // namespace internals
+} // namespace geom
@@ -0,0 +1,516 @@
+//
+// geomcpp
+// Divide-and-conquer Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include "triangle.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+namespace internals
+{
+///////////////////
+
+// Implementation of the Guibas-Stolfi divide-and-conquer algorithm to perform a
+// Delauney triangulation in 2D.
+// - Time: O(n log n) worst case
+// The points are sorted lexicographically and split in half recursively. The
+// triangulations of the halves are merged by zipping them together from their
+// lower common tangent upwards.
+// The triangulation is stored in a quad-edge data structure. Each undirected
+// edge is represented by four directed edges: the edge in both directions and
+// its dual edge in both directions. Edges are referenced by index.
+// The halves of the top levels of the recursion can be triangulated on separate
+// threads. Each thread builds its edges in its own storage. When a thread is
+// done, its edges get appended to the storage of the left half before the
+// halves are merged. This recreates the exact edge layout of a serial run, so
+// the result is identical for any number of threads.
+// Source:
+// Guibas, Stolfi - Primitives for the manipulation of general subdivisions and
+// the computation of Voronoi diagrams, ACM Transactions on Graphics, 1985
+template <typename T> class DelauneyDivideConquer
+{
+ public:
+   // Triangulates the given points using up to the given number of threads.
+   // Exact duplicates are ignored.
+   static std::vector<Triangle<T>> triangulate(std::vector<Point2<T>> points,
+                                               std::size_t numThreads = 1);
+   // Triangulates the given points and returns the result as vertex and index
+   // buffers. Optionally, includes the neighbors of each triangle. The vertices
+   // are sorted lexicographically.
+   static IndexedTriangulation<T> triangulateIndexed(std::vector<Point2<T>> points,
+                                                     std::size_t numThreads,
+                                                     bool withNeighbors);
+
+ private:
+   using EdgeIdx = std::uint32_t;
+   using VertexIdx = std::uint32_t;
+   // Pair of edges that describe the triangulation of a range of points. The
+   // first edge is the ccw convex hull edge out of the leftmost vertex and the
+   // second edge is the cw convex hull edge out of the rightmost vertex.
+   using HullEdges = std::pair<EdgeIdx, EdgeIdx>;
+
+   static constexpr std::uint32_t NoIdx = std::numeric_limits<std::uint32_t>::max();
+   // Minimal number of points in a range for it to be split across threads.
+   // Smaller ranges are not worth the overhead.
+   static constexpr VertexIdx MinParallelPoints = 20000;
+
+   // Operates on the given points. They need to be sorted lexicographically and
+   // free of duplicates.
+   explicit DelauneyDivideConquer(const std::vector<Point2<T>>& points);
+
+   // Triangulates the points in the range [first, last).
+   HullEdges triangulate(VertexIdx first, VertexIdx last);
+   // Triangulates the points in the range [first, last) using up to the given
+   // number of threads.
+   HullEdges triangulateParallel(VertexIdx first, VertexIdx last, std::size_t numThreads);
+   HullEdges triangulateTwoPoints(VertexIdx first);
+   HullEdges triangulateThreePoints(VertexIdx first);
+   // Merges the triangulations of two adjacent ranges of points.
+   HullEdges merge(HullEdges left, HullEdges right);
+   // Moves the edges of another triangulation into this one. Returns the hull
+   // edges of the other triangulation with their new indices.
+   HullEdges append(DelauneyDivideConquer&& other, HullEdges otherHull);
+   std::vector<Triangle<T>> collectTriangles() const;
+   IndexedTriangulation<T> collectIndexedTriangles(bool withNeighbors) const;
+   // Calls a given function with the three ccw primal edges of each triangle.
+   template <typename Fn> void forEachTriangle(Fn fn) const;
+
+   // Sorts the points lexicographically and removes exact duplicates.
+   static void prepare(std::vector<Point2<T>>& points);
+
+   // Quad-edge operations.
+   EdgeIdx makeEdge(VertexIdx from, VertexIdx to);
+   void splice(EdgeIdx a, EdgeIdx b);
+   EdgeIdx connect(EdgeIdx a, EdgeIdx b);
+   void deleteEdge(EdgeIdx e);
+
+   static EdgeIdx rot(EdgeIdx e) { return (e & ~3u) | ((e + 1) & 3u); }
+   static EdgeIdx sym(EdgeIdx e) { return e ^ 2u; }
+   static EdgeIdx invRot(EdgeIdx e) { return (e & ~3u) | ((e + 3) & 3u); }
+   EdgeIdx onext(EdgeIdx e) const { return m_next[e]; }
+   EdgeIdx oprev(EdgeIdx e) const { return rot(onext(rot(e))); }
+   EdgeIdx lnext(EdgeIdx e) const { return rot(onext(invRot(e))); }
+   EdgeIdx rprev(EdgeIdx e) const { return onext(sym(e)); }
+   VertexIdx org(EdgeIdx e) const { return m_origin[e]; }
+   VertexIdx dest(EdgeIdx e) const { return m_origin[sym(e)]; }
+
+   // Geometric predicates on vertices.
+   bool isCcw(VertexIdx a, VertexIdx b, VertexIdx c) const;
+   bool isRightOf(VertexIdx v, EdgeIdx e) const { return isCcw(v, dest(e), org(e)); }
+   bool isLeftOf(VertexIdx v, EdgeIdx e) const { return isCcw(v, org(e), dest(e)); }
+   bool isInCircle(VertexIdx a, VertexIdx b, VertexIdx c, VertexIdx d) const;
+
+ private:
+   const std::vector<Point2<T>>& m_points;
+   // Next ccw edge around the origin of each directed edge.
+   std::vector<EdgeIdx> m_next;
+   // Origin vertex of each directed edge. Only used for primal edges.
+   std::vector<VertexIdx> m_origin;
+   // Marks deleted quad-edges.
+   std::vector<char> m_isDeleted;
+};
+
+
+template <typename T>
+std::vector<Triangle<T>>
+DelauneyDivideConquer<T>::triangulate(std::vector<Point2<T>> points, std::size_t numThreads)
+{
+   prepare(points);
+   if (points.size() < 3)
+      return {};
+
+   DelauneyDivideConquer<T> dc{points};
+   dc.triangulateParallel(0, static_cast<VertexIdx>(points.size()), numThreads);
+   return dc.collectTriangles();
+}
+
+
+template <typename T>
+IndexedTriangulation<T>
+DelauneyDivideConquer<T>::triangulateIndexed(std::vector<Point2<T>> points,
+                                             std::size_t numThreads, bool withNeighbors)
+{
+   prepare(points);
+   if (points.size() < 3)
+      return {};
+
+   DelauneyDivideConquer<T> dc{points};
+   dc.triangulateParallel(0, static_cast<VertexIdx>(points.size()), numThreads);
+   IndexedTriangulation<T> result = dc.collectIndexedTriangles(withNeighbors);
+   // All points are connected by edges but only form triangles if they are not
+   // collinear.
+   if (result.numTriangles() > 0)
+      result.vertices = std::move(points);
+   return result;
+}
+
+
+template <typename T> void DelauneyDivideConquer<T>::prepare(std::vector<Point2<T>>& points)
+{
+   // Exact lexicographic order is required to split the points into
+   // non-overlapping halves.
+   const auto isLess = [](const Point2<T>& a, const Point2<T>& b) {
+      return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+   };
+   const auto isSame = [](const Point2<T>& a, const Point2<T>& b) {
+      return a.x() == b.x() && a.y() == b.y();
+   };
+   std::sort(points.begin(), points.end(), isLess);
+   points.erase(std::unique(points.begin(), points.end(), isSame), points.end());
+}
+
+
+template <typename T>
+DelauneyDivideConquer<T>::DelauneyDivideConquer(const std::vector<Point2<T>>& points)
+: m_points{points}
+{
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::HullEdges
+DelauneyDivideConquer<T>::triangulateParallel(VertexIdx first, VertexIdx last,
+                                              std::size_t numThreads)
+{
+   const VertexIdx numPoints = last - first;
+
+   // A triangulation has at most 3n edges.
+   const std::size_t maxEdges = 3 * static_cast<std::size_t>(numPoints);
+   m_next.reserve(m_next.size() + 4 * maxEdges);
+   m_origin.reserve(m_origin.size() + 4 * maxEdges);
+   m_isDeleted.reserve(m_isDeleted.size() + maxEdges);
+
+   if (numThreads < 2 || numPoints < MinParallelPoints)
+      return triangulate(first, last);
+
+   // Split at the same point as the serial recursion.
+   const VertexIdx middle = first + numPoints / 2;
+   const std::size_t numRightThreads = numThreads / 2;
+
+   DelauneyDivideConquer<T> rightDc{m_points};
+   auto rightHull =
+      std::async(std::launch::async, [&rightDc, middle, last, numRightThreads]() {
+         return rightDc.triangulateParallel(middle, last, numRightThreads);
+      });
+   const HullEdges left =
+      triangulateParallel(first, middle, numThreads - numRightThreads);
+   const HullEdges right = append(std::move(rightDc), rightHull.get());
+   return merge(left, right);
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::HullEdges
+DelauneyDivideConquer<T>::triangulate(VertexIdx first, VertexIdx last)
+{
+   const VertexIdx numPoints = last - first;
+   if (numPoints == 2)
+      return triangulateTwoPoints(first);
+   if (numPoints == 3)
+      return triangulateThreePoints(first);
+
+   const VertexIdx middle = first + numPoints / 2;
+   const HullEdges left = triangulate(first, middle);
+   const HullEdges right = triangulate(middle, last);
+   return merge(left, right);
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::HullEdges
+DelauneyDivideConquer<T>::triangulateTwoPoints(VertexIdx first)
+{
+   const EdgeIdx a = makeEdge(first, first + 1);
+   return {a, sym(a)};
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::HullEdges
+DelauneyDivideConquer<T>::triangulateThreePoints(VertexIdx first)
+{
+   const VertexIdx p1 = first;
+   const VertexIdx p2 = first + 1;
+   const VertexIdx p3 = first + 2;
+
+   const EdgeIdx a = makeEdge(p1, p2);
+   const EdgeIdx b = makeEdge(p2, p3);
+   splice(sym(a), b);
+
+   // Close the triangle. Collinear points stay a chain of two edges.
+   if (isCcw(p1, p2, p3))
+   {
+      connect(b, a);
+      return {a, sym(b)};
+   }
+   if (isCcw(p1, p3, p2))
+   {
+      const EdgeIdx c = connect(b, a);
+      return {sym(c), c};
+   }
+   return {a, sym(b)};
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::HullEdges
+DelauneyDivideConquer<T>::merge(HullEdges left, HullEdges right)
+{
+   auto [leftOuter, leftInner] = left;
+   auto [rightInner, rightOuter] = right;
+
+   // Find the lower common tangent of the two halves.
+   for (;;)
+   {
+      if (isLeftOf(org(rightInner), leftInner))
+         leftInner = lnext(leftInner);
+      else if (isRightOf(org(leftInner), rightInner))
+         rightInner = rprev(rightInner);
+      else
+         break;
+   }
+
+   // Create the first cross edge from the right to the left half.
+   EdgeIdx base = connect(sym(rightInner), leftInner);
+   if (org(leftInner) == org(leftOuter))
+      leftOuter = sym(base);
+   if (org(rightInner) == org(rightOuter))
+      rightOuter = base;
+
+   // Zip the halves together by adding cross edges upwards. Candidate edges
+   // have to be above the current base edge.
+   const auto isValid = [&](EdgeIdx e) { return isRightOf(dest(e), base); };
+
+   for (;;)
+   {
+      // Delete left edges that fail the circle test.
+      EdgeIdx leftCand = onext(sym(base));
+      if (isValid(leftCand))
+      {
+         while (isInCircle(dest(base), org(base), dest(leftCand), dest(onext(leftCand))))
+         {
+            const EdgeIdx next = onext(leftCand);
+            deleteEdge(leftCand);
+            leftCand = next;
+         }
+      }
+
+      // Delete right edges that fail the circle test.
+      EdgeIdx rightCand = oprev(base);
+      if (isValid(rightCand))
+      {
+         while (
+            isInCircle(dest(base), org(base), dest(rightCand), dest(oprev(rightCand))))
+         {
+            const EdgeIdx prev = oprev(rightCand);
+            deleteEdge(rightCand);
+            rightCand = prev;
+         }
+      }
+
+      const bool isLeftValid = isValid(leftCand);
+      const bool isRightValid = isValid(rightCand);
+      // Reached the upper common tangent.
+      if (!isLeftValid && !isRightValid)
+         break;
+
+      // Connect to the candidate whose circle does not contain the other
+      // candidate.
+      if (!isLeftValid ||
+          (isRightValid &&
+           isInCircle(dest(leftCand), org(leftCand), org(rightCand), dest(rightCand))))
+      {
+         base = connect(rightCand, sym(base));
+      }
+      else
+      {
+         base = connect(sym(base), sym(leftCand));
+      }
+   }
+
+   return {leftOuter, rightOuter};
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::HullEdges
+DelauneyDivideConquer<T>::append(DelauneyDivideConquer&& other, HullEdges otherHull)
+{
+   const EdgeIdx offset = static_cast<EdgeIdx>(m_next.size());
+
+   for (EdgeIdx next : other.m_next)
+      m_next.push_back(next + offset);
+   m_origin.insert(m_origin.end(), other.m_origin.begin(), other.m_origin.end());
+   m_isDeleted.insert(m_isDeleted.end(), other.m_isDeleted.begin(),
+                      other.m_isDeleted.end());
+
+   other.m_next.clear();
+   other.m_origin.clear();
+   other.m_isDeleted.clear();
+
+   return {otherHull.first + offset, otherHull.second + offset};
+}
+
+
+template <typename T>
+std::vector<Triangle<T>> DelauneyDivideConquer<T>::collectTriangles() const
+{
+   std::vector<Triangle<T>> triangles;
+   triangles.reserve(2 * m_points.size());
+
+   forEachTriangle([&](EdgeIdx e0, EdgeIdx e1, EdgeIdx e2) {
+      triangles.emplace_back(m_points[org(e0)], m_points[org(e1)], m_points[org(e2)]);
+   });
+
+   return triangles;
+}
+
+
+template <typename T>
+IndexedTriangulation<T>
+DelauneyDivideConquer<T>::collectIndexedTriangles(bool withNeighbors) const
+{
+   IndexedTriangulation<T> result;
+   result.indices.reserve(6 * m_points.size());
+
+   // Index of the triangle that each primal edge is part of.
+   std::vector<std::uint32_t> triangleOfEdge;
+   if (withNeighbors)
+      triangleOfEdge.assign(m_next.size(), NoIdx);
+
+   std::uint32_t numTriangles = 0;
+   forEachTriangle([&](EdgeIdx e0, EdgeIdx e1, EdgeIdx e2) {
+      result.indices.push_back(org(e0));
+      result.indices.push_back(org(e1));
+      result.indices.push_back(org(e2));
+      if (withNeighbors)
+      {
+         triangleOfEdge[e0] = numTriangles;
+         triangleOfEdge[e1] = numTriangles;
+         triangleOfEdge[e2] = numTriangles;
+      }
+      ++numTriangles;
+   });
+
+   if (withNeighbors)
+   {
+      // The neighbor opposite of a vertex is the triangle on the other side of
+      // the edge that follows the vertex's outgoing edge. Edges of the outer face
+      // are not part of any triangle and map to NoIdx, which is the same value
+      // as IndexedTriangulation::NoNeighbor.
+      result.neighbors.resize(result.indices.size());
+      forEachTriangle([&](EdgeIdx e0, EdgeIdx e1, EdgeIdx e2) {
+         const std::size_t base = 3 * static_cast<std::size_t>(triangleOfEdge[e0]);
+         result.neighbors[base] = triangleOfEdge[sym(e1)];
+         result.neighbors[base + 1] = triangleOfEdge[sym(e2)];
+         result.neighbors[base + 2] = triangleOfEdge[sym(e0)];
+      });
+   }
+
+   return result;
+}
+
+
+template <typename T>
+template <typename Fn>
+void DelauneyDivideConquer<T>::forEachTriangle(Fn fn) const
+{
+   // Each triangle is the left face of three primal edges. Visit each face once
+   // through the first of its edges that is encountered.
+   std::vector<char> isVisited(m_next.size(), false);
+   for (EdgeIdx e = 0; e < m_next.size(); e += 2)
+   {
+      if (isVisited[e] || m_isDeleted[e / 4])
+         continue;
+
+      const EdgeIdx e1 = lnext(e);
+      const EdgeIdx e2 = lnext(e1);
+      isVisited[e] = true;
+      isVisited[e1] = true;
+      isVisited[e2] = true;
+
+      // The outer face is cw and has more than three edges unless the whole
+      // triangulation is a single triangle.
+      if (lnext(e2) == e && isCcw(org(e), org(e1), org(e2)))
+         fn(e, e1, e2);
+   }
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::EdgeIdx
+DelauneyDivideConquer<T>::makeEdge(VertexIdx from, VertexIdx to)
+{
+   const EdgeIdx e = static_cast<EdgeIdx>(m_next.size());
+   m_next.push_back(e);
+   m_next.push_back(e + 3);
+   m_next.push_back(e + 2);
+   m_next.push_back(e + 1);
+   m_origin.push_back(from);
+   m_origin.push_back(NoIdx);
+   m_origin.push_back(to);
+   m_origin.push_back(NoIdx);
+   m_isDeleted.push_back(false);
+   return e;
+}
+
+
+template <typename T> void DelauneyDivideConquer<T>::splice(EdgeIdx a, EdgeIdx b)
+{
+   const EdgeIdx alpha = rot(onext(a));
+   const EdgeIdx beta = rot(onext(b));
+   std::swap(m_next[a], m_next[b]);
+   std::swap(m_next[alpha], m_next[beta]);
+}
+
+
+template <typename T>
+typename DelauneyDivideConquer<T>::EdgeIdx
+DelauneyDivideConquer<T>::connect(EdgeIdx a, EdgeIdx b)
+{
+   const EdgeIdx e = makeEdge(dest(a), org(b));
+   splice(e, lnext(a));
+   splice(sym(e), b);
+   return e;
+}
+
+
+template <typename T> void DelauneyDivideConquer<T>::deleteEdge(EdgeIdx e)
+{
+   splice(e, oprev(e));
+   splice(sym(e), oprev(sym(e)));
+   m_isDeleted[e / 4] = true;
+}
+
+
+template <typename T>
+bool DelauneyDivideConquer<T>::isCcw(VertexIdx a, VertexIdx b, VertexIdx c) const
+{
+   return orient2d(m_points[a], m_points[b], m_points[c]) > 0;
+}
+
+
+template <typename T>
+bool DelauneyDivideConquer<T>::isInCircle(VertexIdx a, VertexIdx b, VertexIdx c,
+                                          VertexIdx d) const
+{
+   return inCircle(m_points[a], m_points[b], m_points[c], m_points[d]) > 0;
+}
+
+} // namespace internals
+} // namespace geom
@@ -0,0 +1,1846 @@
+//
+// geomcpp
+// Index-based triangle mesh for Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_stats.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include "triangle.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+namespace internals
+{
+///////////////////
+
+// Mesh of triangles that are connected through their neighbor relationships.
+// Used as core data structure of the Bowyer-Watson algorithm:
+// - Vertices are stored once and referenced by index.
+// - Each triangle references its vertices in ccw order (cartesian coordinate
+//   system) and its neighbors across each of its edges.
+// - Points are located by walking from triangle to triangle towards the point.
+// - The cavity of triangles whose circumcircle contains a new point is grown
+//   through the neighbor relationships starting at the triangle that contains
+//   the point.
+// The convex hull is closed off with ghost triangles. Each ghost triangle
+// connects a hull edge to a symbolic ghost vertex that lies outside of all
+// other vertices. No artificial vertices with coordinates are needed, so the
+// points can be anywhere and the result needs no cleanup. The circumcircle of a
+// ghost triangle degenerates to the open half-plane outside of its hull edge
+// together with the open edge itself.
+// Slots of removed triangles and vertices are kept in free lists and reused,
+// so the lists don't grow beyond the largest number of triangles and vertices
+// that the mesh had at once.
+template <typename T> class DelauneyMesh
+{
+ public:
+   using VertexIdx = std::uint32_t;
+   using TriangleIdx = std::uint32_t;
+
+   static constexpr std::uint32_t NoIdx = std::numeric_limits<std::uint32_t>::max();
+   // Index of the ghost vertex. It has no coordinates and is not stored in the
+   // vertex list.
+   static constexpr VertexIdx GhostVertex = NoIdx - 1;
+
+   struct MeshTriangle
+   {
+      // Vertex indices in ccw order.
+      std::array<VertexIdx, 3> vertices;
+      // Neighbor triangles. The neighbor at index i is across the edge
+      // opposite of vertex i, i.e. the edge from vertex i+1 to i+2.
+      std::array<TriangleIdx, 3> neighbors;
+   };
+
+ public:
+   // Initializes an empty mesh. Discards any previous content but keeps the
+   // allocated memory.
+   void init(std::size_t expectedNumPoints);
+   // Inserts a given point into the mesh. Returns the vertex index of the point
+   // or NoIdx if the point coincides exactly with an existing vertex.
+   // Until the first three points that are not collinear are inserted, the mesh
+   // has no triangles and only collects the points. Points outside of the hull
+   // are located in the ghost triangle of a hull edge that they can see. A point
+   // on a constrained edge splits it.
+   VertexIdx insert(const Point2<T>& pt);
+   // Removes the vertex at a given point from the mesh. Returns false if no
+   // vertex is at the point. The vertex index can be reused by later insertions.
+   // The hole is filled by clipping ears from its outline. Each clipped ear is
+   // chosen so that its circumcircle does not contain any other outline vertex,
+   // which makes it a Delauney triangle. Constrained edges at the vertex are
+   // lost.
+   bool remove(const Point2<T>& pt);
+   // Moves the vertex at a given index to a new position. Returns false if the
+   // vertex is not part of the mesh or if another vertex is exactly at the new
+   // position. In this case the vertex keeps its position.
+   // When the vertex stays inside the polygon formed by its surrounding
+   // triangles, only the edges that violate the Delauney condition afterwards
+   // are flipped (Lawson's algorithm). Edge flips keep constrained edges.
+   // Otherwise the vertex is removed and inserted again at its new position and
+   // its constrained edges are lost.
+   bool move(VertexIdx vertex, const Point2<T>& pt);
+   // Moves all vertices to new positions. The position at index i is the new
+   // position of vertex i. Returns the number of vertices that keep their
+   // position because another vertex is exactly at their new position. The
+   // positions of vertices that are not part of the mesh are ignored.
+   // The triangles are checked in a single pass. Only vertices whose triangles
+   // become invalid are moved one by one.
+   std::size_t moveAll(const std::vector<Point2<T>>& positions);
+   // Makes the edge between two vertices a constrained edge. Vertices on the
+   // edge split it into multiple constrained edges. Where the edge crosses
+   // another constrained edge, both are split at a new vertex at their
+   // intersection. Returns false if the mesh has no triangles, if a vertex is
+   // not part of the mesh or if the edge could not be inserted completely
+   // because of numerical trouble, e.g. an intersection that cannot be
+   // represented.
+   // The triangles that the edge crosses are removed and the polygons on both
+   // of its sides are triangulated again. Later insertions don't grow their
+   // cavities across constrained edges, so the edges stay part of the mesh.
+   bool insertSegment(VertexIdx a, VertexIdx b);
+   // Checks if the edge between two vertices is constrained.
+   bool isConstrained(VertexIdx a, VertexIdx b) const
+   {
+      return m_constraints.find(edgeKey(a, b)) != m_constraints.end();
+   }
+   // Returns the number of constrained edges that were lost because a vertex
+   // that split them could not be connected to their ends.
+   std::size_t numLostConstraints() const { return m_numLostConstraints; }
+
+   // Finds the triangle that contains a given point by walking the mesh starting
+   // at a given triangle. For points outside of the convex hull a ghost
+   // triangle whose hull edge separates the point from the hull is returned.
+   // Requires the mesh to have triangles.
+   TriangleIdx locate(const Point2<T>& pt, TriangleIdx start) const;
+   // Returns the index of the vertex that is exactly at a given point or NoIdx
+   // if no vertex is.
+   VertexIdx vertexAt(const Point2<T>& pt) const;
+
+   // Returns the number of vertex slots including the free slots of removed
+   // vertices.
+   std::size_t numVertices() const { return m_vertices.size(); }
+   const Point2<T>& vertex(VertexIdx idx) const { return m_vertices[idx]; }
+   std::size_t numTriangleSlots() const { return m_triangles.size(); }
+   const MeshTriangle& triangle(TriangleIdx idx) const { return m_triangles[idx]; }
+   // Checks if the triangle at a given index has been removed from the mesh.
+   bool isRemoved(TriangleIdx idx) const { return m_triangles[idx].vertices[0] == NoIdx; }
+   // Checks if the triangle at a given index is a ghost triangle.
+   bool isGhost(TriangleIdx idx) const { return ghostSlot(idx) < 3; }
+   // Checks if the mesh has any triangles. Without triangles all points are
+   // collinear or there are less than three points.
+   bool hasTriangles() const { return m_lastTriangle != NoIdx; }
+   // Returns the statistics collected since the last call to init(). Records
+   // how much work each insertion takes. Empty unless statistics are enabled.
+   // See delauney_stats.h.
+   const DelauneyStats& stats() const { return m_stats; }
+
+   // Returns the triangles of the mesh without ghost triangles.
+   std::vector<Triangle<T>> triangles() const;
+   // Stores the triangles of the mesh without ghost triangles in a given vector.
+   // Reuses the vector's memory. Optionally, only the triangles whose slots are
+   // marked in a given selection are stored.
+   void triangles(std::vector<Triangle<T>>& result,
+                  const std::vector<char>* selection = nullptr) const;
+   // Returns the triangles of the mesh without ghost triangles as vertex and
+   // index buffers. Optionally, includes the neighbors of each triangle.
+   IndexedTriangulation<T> indexedTriangles(bool withNeighbors);
+   // Stores the triangles of the mesh without ghost triangles in given vertex and
+   // index buffers. Reuses the memory of the buffers. Optionally, only the
+   // triangles whose slots are marked in a given selection are stored. Neighbors
+   // that are not selected are stored as NoIdx.
+   void indexedTriangles(bool withNeighbors, IndexedTriangulation<T>& result,
+                         const std::vector<char>* selection = nullptr);
+
+ private:
+   // Cavity edge that will be connected to the inserted point.
+   struct BoundaryEdge
+   {
+      VertexIdx from;
+      VertexIdx to;
+      // Triangle outside of the cavity.
+      TriangleIdx outer;
+      // Cavity triangle that the edge belongs to.
+      TriangleIdx inner;
+   };
+
+   // Adds a point to a mesh that has no triangles yet.
+   VertexIdx insertWithoutTriangles(const Point2<T>& pt);
+   // Adds a vertex to the pending vertices of a mesh that has no triangles yet.
+   // Creates the first triangles once the vertex is not collinear with the
+   // previously pending vertices.
+   void addPendingVertex(VertexIdx vertex);
+   // Creates the first triangle and its ghost triangles.
+   void createFirstTriangle(VertexIdx a, VertexIdx b, VertexIdx c);
+   // Inserts a vertex that is already in the vertex list into the triangles.
+   void insertVertex(VertexIdx vertex);
+   // Discards all triangles. Used when the remaining points don't form any
+   // triangles anymore.
+   void discardTriangles(const std::vector<VertexIdx>& remainingVertices);
+   // Removes a vertex from the triangles. Takes a triangle that the vertex
+   // belongs to.
+   void removeVertex(TriangleIdx container, VertexIdx vertex);
+   // Moves a vertex of a mesh that has no triangles yet.
+   bool movePending(VertexIdx vertex, const Point2<T>& pt);
+
+   // Finds the triangle that contains a given point by walking the mesh starting
+   // at a given triangle. Returns the number of visited triangles in numSteps.
+   TriangleIdx walk(const Point2<T>& pt, TriangleIdx start, std::size_t& numSteps) const;
+   // Locates a point that gets inserted and records statistics about the walk.
+   TriangleIdx locateForInsertion(const Point2<T>& pt);
+   // Counts the allocation that adding an element to a full vector causes.
+   template <typename V>
+   static void recordGrowth(const std::vector<V>& v, std::size_t& numAllocations);
+
+   // Finds the triangles whose circumcircle contains the given point.
+   void findCavity(const Point2<T>& pt, TriangleIdx start);
+   // Fills the cavity with triangles that connect its outline to the given vertex.
+   void fillCavity(VertexIdx vertex);
+   // Adds a triangle into a free slot or at the end of the triangle list.
+   TriangleIdx addTriangle(VertexIdx a, VertexIdx b, VertexIdx c);
+   // Adds a vertex into a free slot or at the end of the vertex list.
+   VertexIdx addVertex(const Point2<T>& pt);
+   // Returns the position of the ghost vertex within a triangle or 3 if the
+   // triangle is not a ghost triangle.
+   std::size_t ghostSlot(TriangleIdx idx) const;
+   // Returns the new triangle that starts at a given vertex of the current
+   // cavity outline.
+   TriangleIdx& triangleStartingAt(VertexIdx vertex);
+   // Marks a triangle as removed and makes its slot available for reuse.
+   void removeTriangle(TriangleIdx idx);
+   // Replaces the reference to a given neighbor of a triangle with a new neighbor.
+   void replaceNeighbor(TriangleIdx idx, TriangleIdx oldNeighbor,
+                        TriangleIdx newNeighbor);
+   // Finds the triangle that contains a given point by checking all triangles.
+   TriangleIdx locateByScan(const Point2<T>& pt) const;
+   // Returns the index of the vertex of a triangle that is exactly at a given
+   // point or NoIdx if none of its vertices is.
+   VertexIdx findVertex(TriangleIdx idx, const Point2<T>& pt) const;
+   // Checks if a vertex is exactly at a given point.
+   bool isAt(VertexIdx idx, const Point2<T>& pt) const
+   {
+      return m_vertices[idx].x() == pt.x() && m_vertices[idx].y() == pt.y();
+   }
+
+   // Collects the outline of the triangles around a given vertex.
+   void findStar(TriangleIdx start, VertexIdx vertex);
+   // Checks if the vertices of the current hole outline are all on a line.
+   bool isHoleCollinear() const;
+   // Fills the outline of a removed vertex with triangles.
+   void fillHole();
+
+   // Checks if moving the vertex of the current star to a given point keeps its
+   // triangles valid. For vertices on the hull, the hull has to stay convex.
+   bool isInStar(const Point2<T>& pt) const;
+   // Returns the hull vertex before the start or after the end of a hull edge.
+   // Takes the ghost triangle of the hull edge.
+   VertexIdx prevHullVertex(TriangleIdx ghost) const;
+   VertexIdx nextHullVertex(TriangleIdx ghost) const;
+   // Flips edges that violate the Delauney condition until none is left. Starts
+   // with the edges of the triangles in the current star.
+   void flipStarEdges();
+   // Flips edges that violate the Delauney condition until none is left. Starts
+   // with the edges on the flip stack.
+   void flipEdges();
+   // Restores the previous position of the vertices of triangles that are not
+   // valid anymore until all triangles are valid. Collects the restored vertices.
+   void restoreInvalidTriangles();
+   // Restores the previous position of the vertices of a triangle. The ghost
+   // vertex is skipped.
+   void restoreVertices(const MeshTriangle& t);
+   // Checks if the edge across a given slot of a triangle violates the Delauney
+   // condition. Edges of ghost triangles never do because the hull is convex.
+   // Constrained edges are never flipped.
+   bool isFlippable(TriangleIdx idx, std::size_t slot) const;
+   // Replaces the edge across a given slot of a triangle and its neighbor with
+   // the other diagonal of the quadrilateral that they form. Adds the outer edges
+   // of the quadrilateral to the flip stack.
+   void flip(TriangleIdx idx, std::size_t slot);
+
+   // Checks if a given point is strictly inside the circumcircle of a triangle.
+   // For ghost triangles checks if the point is strictly outside of the hull
+   // edge or on the open hull edge.
+   bool isInCircumcircle(TriangleIdx idx, const Point2<T>& pt) const;
+   // Checks if the triangle formed by three outline vertices of a removed
+   // vertex can be clipped as ear, i.e. whether it is ccw and no other outline
+   // vertex is inside its circumcircle.
+   bool isDelauneyEar(std::size_t first) const;
+   // Checks if a given point is strictly between two points on the same line.
+   static bool isBetween(const Point2<T>& pt, const Point2<T>& a, const Point2<T>& b);
+
+   // Key of the undirected edge between two vertices.
+   static std::uint64_t edgeKey(VertexIdx a, VertexIdx b)
+   {
+      if (a > b)
+         std::swap(a, b);
+      return (static_cast<std::uint64_t>(a) << 32) | b;
+   }
+   // Finds a constrained edge of a triangle that a given point is on. Returns
+   // its vertices or NoIdx if the point is not on a constrained edge.
+   std::pair<VertexIdx, VertexIdx> findConstrainedEdgeAt(TriangleIdx idx,
+                                                         const Point2<T>& pt) const;
+   // Collects the triangles that the segment from a to b crosses, starting with
+   // the triangle of the current star at a given index. Collects the vertices
+   // on both sides of the segment. Returns the vertex where the crossed
+   // triangles end, i.e. b or a vertex on the segment. When the segment crosses
+   // a constrained edge, returns NoIdx and stores the edge's vertices in
+   // crossedConstraint.
+   VertexIdx findCrossedTriangles(VertexIdx a, VertexIdx b, std::size_t starIdx,
+                                  std::pair<VertexIdx, VertexIdx>& crossedConstraint);
+   // Splits the segment from a to b and the constrained edge from x to y that
+   // it crosses at a new vertex. Returns the new vertex or NoIdx if the edge
+   // from x to y could not be restored through it.
+   VertexIdx splitAtIntersection(VertexIdx a, VertexIdx b, VertexIdx x, VertexIdx y);
+   // Replaces the crossed triangles with triangles on both sides of the edge from
+   // a to a given end vertex.
+   void retriangulateCrossed(VertexIdx a, VertexIdx end);
+   // Triangulates the polygon formed by the edge from p to q and a chain of
+   // vertices to the left of it. Picks the Delauney triangle for each edge.
+   void triangulatePseudoPolygon(VertexIdx p, VertexIdx q,
+                                 const std::vector<VertexIdx>& chain);
+   // Checks if a point on the line through a and b is on the side of b.
+   static bool isAhead(const Point2<T>& pt, const Point2<T>& a, const Point2<T>& b);
+
+ private:
+   std::vector<Point2<T>> m_vertices;
+   std::vector<MeshTriangle> m_triangles;
+   // Slots of removed triangles that can be reused.
+   std::vector<TriangleIdx> m_freeTriangles;
+   // Slots of removed vertices that can be reused.
+   std::vector<VertexIdx> m_freeVertices;
+   // Number of triangles that are not ghost triangles.
+   std::size_t m_numSolidTriangles = 0;
+   // Triangle that the next point location walk starts at. Never a ghost
+   // triangle. NoIdx while the mesh has no triangles.
+   TriangleIdx m_lastTriangle = NoIdx;
+   // Vertices that are not part of any triangle because the mesh has no
+   // triangles yet.
+   std::vector<VertexIdx> m_pendingVertices;
+
+   // Scratch data for inserting points. Kept as members to reuse their memory.
+   std::vector<TriangleIdx> m_cavity;
+   std::vector<BoundaryEdge> m_boundary;
+   // Marks triangles that are part of the current cavity.
+   std::vector<char> m_inCavity;
+   // For each vertex of the cavity outline the new triangle that starts at it.
+   std::vector<TriangleIdx> m_triangleStartingAt;
+   TriangleIdx m_ghostTriangleStartingAt = NoIdx;
+   // Triangles that fill the current cavity.
+   std::vector<TriangleIdx> m_newTriangles;
+
+   // Scratch data for collecting indexed triangles.
+   // New index of each triangle and vertex in the result.
+   std::vector<TriangleIdx> m_triangleMapping;
+   std::vector<VertexIdx> m_vertexMapping;
+
+   // Scratch data for removing and moving points.
+   // Edge of the outline of a removed vertex.
+   struct HoleEdge
+   {
+      // Vertex that the edge starts at.
+      VertexIdx from;
+      // Triangle outside of the hole and the slot of its neighbors that
+      // references the hole. The slot is only set while filling the hole.
+      TriangleIdx outer;
+      std::size_t outerSlot;
+   };
+   // Triangles around the removed vertex.
+   std::vector<TriangleIdx> m_star;
+   // Outline of the hole in ccw order.
+   std::vector<HoleEdge> m_hole;
+
+   // Scratch data for moving points. Edges that might have to be flipped given
+   // as triangle and slot of the opposite vertex.
+   std::vector<std::pair<TriangleIdx, std::size_t>> m_flipStack;
+   // Positions before moving all vertices.
+   std::vector<Point2<T>> m_prevVertices;
+   // Vertices that are restored to their previous position.
+   std::vector<char> m_isRestored;
+   std::vector<VertexIdx> m_restored;
+
+   // Constrained edges keyed by their vertices.
+   std::unordered_set<std::uint64_t> m_constraints;
+   std::size_t m_numLostConstraints = 0;
+   // Scratch data for inserting constrained edges.
+   // Triangles crossed by the edge.
+   std::vector<TriangleIdx> m_crossed;
+   // Vertices left and right of the edge in the order from start to end.
+   std::vector<VertexIdx> m_leftChain;
+   std::vector<VertexIdx> m_rightChain;
+   // Sub-polygon left of an edge from p to q given as range of a chain.
+   struct PolygonPart
+   {
+      VertexIdx p;
+      VertexIdx q;
+      std::size_t first;
+      std::size_t last;
+   };
+   std::vector<PolygonPart> m_polygonParts;
+   // Edge of a triangle that fills the crossed triangles or of a triangle
+   // outside of them. Used to link the triangles across equal edges.
+   struct LinkEdge
+   {
+      std::uint64_t key;
+      TriangleIdx idx;
+      // Slot of the edge in a new triangle.
+      std::size_t slot;
+      // For outside triangles, the crossed triangle across the edge. NoIdx for
+      // new triangles.
+      TriangleIdx inner;
+   };
+   std::vector<LinkEdge> m_linkEdges;
+
+   DelauneyStats m_stats;
+};
+
+
+template <typename T> void DelauneyMesh<T>::init(std::size_t expectedNumPoints)
+{
+   m_vertices.clear();
+   m_triangles.clear();
+   m_freeTriangles.clear();
+   m_freeVertices.clear();
+   m_inCavity.clear();
+   m_triangleStartingAt.clear();
+   m_pendingVertices.clear();
+   m_constraints.clear();
+   m_numLostConstraints = 0;
+   m_numSolidTriangles = 0;
+   m_lastTriangle = NoIdx;
+   if constexpr (DelauneyStatsEnabled)
+      m_stats = {};
+
+   // Including the ghost triangles, a mesh of n points has 2n - 2 triangles.
+   m_vertices.reserve(expectedNumPoints);
+   m_triangleStartingAt.reserve(expectedNumPoints);
+   m_triangles.reserve(2 * expectedNumPoints);
+   m_inCavity.reserve(2 * expectedNumPoints);
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx DelauneyMesh<T>::insert(const Point2<T>& pt)
+{
+   if (!hasTriangles())
+      return insertWithoutTriangles(pt);
+
+   const TriangleIdx container = locateForInsertion(pt);
+   if (findVertex(container, pt) != NoIdx)
+   {
+      if constexpr (DelauneyStatsEnabled)
+         ++m_stats.numDuplicatePoints;
+      return NoIdx;
+   }
+
+   // A point on a constrained edge splits it. The cavity can cross the edge then.
+   std::pair<VertexIdx, VertexIdx> split{NoIdx, NoIdx};
+   if (!m_constraints.empty())
+   {
+      split = findConstrainedEdgeAt(container, pt);
+      if (split.first != NoIdx)
+         m_constraints.erase(edgeKey(split.first, split.second));
+   }
+
+   const VertexIdx vertex = addVertex(pt);
+   findCavity(pt, container);
+   fillCavity(vertex);
+
+   if (split.first != NoIdx && (!insertSegment(split.first, vertex) ||
+                                !insertSegment(vertex, split.second)))
+   {
+      ++m_numLostConstraints;
+   }
+
+   if constexpr (DelauneyStatsEnabled)
+      ++m_stats.numInsertedPoints;
+   return vertex;
+}
+
+
+template <typename T> bool DelauneyMesh<T>::remove(const Point2<T>& pt)
+{
+   if (!hasTriangles())
+   {
+      const auto pos = std::find_if(
+         m_pendingVertices.begin(), m_pendingVertices.end(),
+         [this, &pt](VertexIdx v) { return isAt(v, pt); });
+      if (pos == m_pendingVertices.end())
+         return false;
+      m_freeVertices.push_back(*pos);
+      m_pendingVertices.erase(pos);
+      return true;
+   }
+
+   // A point that is a vertex of the mesh is located at one of the triangles
+   // around it.
+   const TriangleIdx container = locate(pt, m_lastTriangle);
+   const VertexIdx vertex = findVertex(container, pt);
+   if (vertex == NoIdx)
+      return false;
+
+   removeVertex(container, vertex);
+   m_freeVertices.push_back(vertex);
+   return true;
+}
+
+
+template <typename T> bool DelauneyMesh<T>::move(VertexIdx vertex, const Point2<T>& pt)
+{
+   if (vertex >= m_vertices.size())
+      return false;
+   if (!hasTriangles())
+      return movePending(vertex, pt);
+
+   // The walk to the vertex's position ends at one of the triangles around it.
+   const Point2<T> prevPt = m_vertices[vertex];
+   const TriangleIdx container = locate(prevPt, m_lastTriangle);
+   if (findVertex(container, prevPt) != vertex)
+      return false;
+   // Continue the next walk here. Callers typically move nearby vertices one
+   // after the other.
+   if (!isGhost(container))
+      m_lastTriangle = container;
+   if (isAt(vertex, pt))
+      return true;
+
+   findStar(container, vertex);
+   if (isInStar(pt))
+   {
+      m_vertices[vertex] = pt;
+      for (const TriangleIdx idx : m_star)
+         if (!isGhost(idx))
+            m_lastTriangle = idx;
+      flipStarEdges();
+      return true;
+   }
+
+   // The vertex leaves its star. Reinsert it unless it would coincide with
+   // another vertex.
+   const TriangleIdx target = locate(pt, container);
+   if (findVertex(target, pt) != NoIdx)
+      return false;
+
+   if constexpr (DelauneyStatsEnabled)
+      ++m_stats.numReinsertedPoints;
+   removeVertex(container, vertex);
+   m_vertices[vertex] = pt;
+   if (hasTriangles())
+      insertVertex(vertex);
+   else
+      addPendingVertex(vertex);
+   return true;
+}
+
+
+template <typename T>
+std::size_t DelauneyMesh<T>::moveAll(const std::vector<Point2<T>>& positions)
+{
+   assert(positions.size() == m_vertices.size());
+
+   std::size_t numBlocked = 0;
+   if (!hasTriangles())
+   {
+      const std::vector<VertexIdx> pending = m_pendingVertices;
+      for (const VertexIdx v : pending)
+         if (!move(v, positions[v]))
+            ++numBlocked;
+      return numBlocked;
+   }
+
+   // Move all vertices and take back the moves that make triangles invalid. The
+   // other vertices still form a valid triangulation. Removed vertices are not
+   // referenced by any triangle and can be moved freely.
+   m_prevVertices.assign(m_vertices.begin(), m_vertices.end());
+   m_vertices.assign(positions.begin(), positions.end());
+   restoreInvalidTriangles();
+
+   // Restore the Delauney condition for the valid part.
+   m_flipStack.clear();
+   for (TriangleIdx idx = 0; idx < m_triangles.size(); ++idx)
+   {
+      if (isRemoved(idx) || isGhost(idx))
+         continue;
+      for (std::size_t slot = 0; slot < 3; ++slot)
+         if (m_triangles[idx].neighbors[slot] < idx)
+            m_flipStack.emplace_back(idx, slot);
+   }
+   flipEdges();
+
+   // Move the restored vertices one at a time.
+   for (const VertexIdx v : m_restored)
+   {
+      m_isRestored[v] = false;
+      if (!move(v, positions[v]))
+         ++numBlocked;
+   }
+   return numBlocked;
+}
+
+
+template <typename T> void DelauneyMesh<T>::restoreInvalidTriangles()
+{
+   m_isRestored.assign(m_vertices.size(), false);
+   m_restored.clear();
+
+   // Restoring vertices can make other triangles invalid. Repeat until all
+   // triangles are valid. At the latest this happens when all vertices are
+   // back at their previous positions.
+   bool isRestored = true;
+   while (isRestored)
+   {
+      const std::size_t numRestored = m_restored.size();
+      for (TriangleIdx idx = 0; idx < m_triangles.size(); ++idx)
+      {
+         if (isRemoved(idx))
+            continue;
+
+         // Solid triangles have to stay ccw. Ghost triangles check that the hull
+         // stays convex at the end of their hull edge.
+         const MeshTriangle& t = m_triangles[idx];
+         const std::size_t slot = ghostSlot(idx);
+         if (slot == 3)
+         {
+            if (orient2d(m_vertices[t.vertices[0]], m_vertices[t.vertices[1]],
+                         m_vertices[t.vertices[2]]) <= 0)
+            {
+               restoreVertices(t);
+            }
+         }
+         else
+         {
+            const VertexIdx next = nextHullVertex(idx);
+            if (orient2d(m_vertices[t.vertices[(slot + 2) % 3]],
+                         m_vertices[t.vertices[(slot + 1) % 3]], m_vertices[next]) <= 0)
+            {
+               restoreVertices(t);
+               restoreVertices(m_triangles[m_triangles[idx].neighbors[(slot + 2) % 3]]);
+            }
+         }
+      }
+      isRestored = m_restored.size() > numRestored;
+   }
+}
+
+
+template <typename T> void DelauneyMesh<T>::restoreVertices(const MeshTriangle& t)
+{
+   for (const VertexIdx v : t.vertices)
+   {
+      if (v != GhostVertex && !m_isRestored[v])
+      {
+         m_vertices[v] = m_prevVertices[v];
+         m_isRestored[v] = true;
+         m_restored.push_back(v);
+      }
+   }
+}
+
+
+template <typename T> bool DelauneyMesh<T>::insertSegment(VertexIdx a, VertexIdx b)
+{
+   if (!hasTriangles() || a >= m_vertices.size() || b >= m_vertices.size())
+      return false;
+
+   // Insert the segment piece by piece. Each piece ends at b, at a vertex on the
+   // segment or at the intersection with another constrained edge.
+   while (a != b)
+   {
+      const Point2<T> pa = m_vertices[a];
+      const Point2<T> pb = m_vertices[b];
+      const TriangleIdx container = locate(pa, m_lastTriangle);
+      if (findVertex(container, pa) != a)
+         return false;
+      findStar(container, a);
+
+      // Find the star vertex that the segment passes through or the star
+      // triangle (a, x, y) whose outline edge the segment crosses.
+      const std::size_t n = m_hole.size();
+      VertexIdx through = NoIdx;
+      std::size_t crossed = n;
+      for (std::size_t k = 0; k < n && through == NoIdx; ++k)
+      {
+         const VertexIdx x = m_hole[k].from;
+         const VertexIdx y = m_hole[(k + 1) % n].from;
+         if (x == GhostVertex)
+            continue;
+
+         const auto orientation = orient2d(pa, pb, m_vertices[x]);
+         if (orientation == 0 && isAhead(m_vertices[x], pa, pb))
+            through = x;
+         else if (orientation < 0 && y != GhostVertex &&
+                  orient2d(pa, pb, m_vertices[y]) > 0)
+            crossed = k;
+      }
+
+      if (through != NoIdx)
+      {
+         m_constraints.insert(edgeKey(a, through));
+         a = through;
+         continue;
+      }
+      // Guard against numerical trouble.
+      if (crossed == n)
+         return false;
+
+      std::pair<VertexIdx, VertexIdx> constraint{NoIdx, NoIdx};
+      const VertexIdx end = findCrossedTriangles(a, b, crossed, constraint);
+      if (end == NoIdx)
+      {
+         const VertexIdx split =
+            splitAtIntersection(a, b, constraint.first, constraint.second);
+         if (split == NoIdx || !insertSegment(a, split))
+            return false;
+         a = split;
+         continue;
+      }
+
+      retriangulateCrossed(a, end);
+      m_constraints.insert(edgeKey(a, end));
+      a = end;
+   }
+   return true;
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx
+DelauneyMesh<T>::findCrossedTriangles(VertexIdx a, VertexIdx b, std::size_t starIdx,
+                                      std::pair<VertexIdx, VertexIdx>& crossedConstraint)
+{
+   const Point2<T>& pa = m_vertices[a];
+   const Point2<T>& pb = m_vertices[b];
+
+   // The segment leaves each crossed triangle through the edge from x to y with
+   // x on its right and y on its left. The next triangle is across that edge.
+   TriangleIdx current = m_star[starIdx];
+   VertexIdx x = m_hole[starIdx].from;
+   VertexIdx y = m_hole[(starIdx + 1) % m_hole.size()].from;
+   m_crossed.assign(1, current);
+   m_rightChain.assign(1, x);
+   m_leftChain.assign(1, y);
+
+   for (;;)
+   {
+      if (isConstrained(x, y))
+      {
+         crossedConstraint = {x, y};
+         return NoIdx;
+      }
+
+      const MeshTriangle& t = m_triangles[current];
+      std::size_t slot = 0;
+      while (t.vertices[slot] == x || t.vertices[slot] == y)
+         ++slot;
+      current = t.neighbors[slot];
+      m_crossed.push_back(current);
+
+      const MeshTriangle& next = m_triangles[current];
+      std::size_t opposite = 0;
+      while (next.vertices[opposite] == x || next.vertices[opposite] == y)
+         ++opposite;
+      const VertexIdx v = next.vertices[opposite];
+      if (v == b)
+         return v;
+
+      const auto orientation = orient2d(pa, pb, m_vertices[v]);
+      if (orientation == 0)
+         return v;
+      if (orientation < 0)
+      {
+         m_rightChain.push_back(v);
+         x = v;
+      }
+      else
+      {
+         m_leftChain.push_back(v);
+         y = v;
+      }
+   }
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx
+DelauneyMesh<T>::splitAtIntersection(VertexIdx a, VertexIdx b, VertexIdx x, VertexIdx y)
+{
+   const Point2<T>& pa = m_vertices[a];
+   const Point2<T>& pb = m_vertices[b];
+   const Point2<T>& px = m_vertices[x];
+   const Point2<T>& py = m_vertices[y];
+
+   // Intersection of the lines through a, b and x, y. The segments are known
+   // to cross, so the denominator is not zero.
+   const T abx = pb.x() - pa.x();
+   const T aby = pb.y() - pa.y();
+   const T xyx = py.x() - px.x();
+   const T xyy = py.y() - px.y();
+   const T factor = ((px.x() - pa.x()) * xyy - (px.y() - pa.y()) * xyx) /
+                    (abx * xyy - aby * xyx);
+   const Point2<T> intersection{pa.x() + factor * abx, pa.y() + factor * aby};
+   // Guard against intersections that cannot be represented.
+   if (!std::isfinite(intersection.x()) || !std::isfinite(intersection.y()))
+      return NoIdx;
+
+   // Without its constraint the edge from x to y might violate the Delauney
+   // condition.
+   m_constraints.erase(edgeKey(x, y));
+   findStar(locate(px, m_lastTriangle), x);
+   m_flipStack.clear();
+   for (std::size_t k = 0; k < m_hole.size(); ++k)
+   {
+      if (m_hole[k].from != y)
+         continue;
+      // The star triangle is (x, y, z). Its edge from x to y is opposite of z.
+      const MeshTriangle& t = m_triangles[m_star[k]];
+      const VertexIdx z = m_hole[(k + 1) % m_hole.size()].from;
+      m_flipStack.emplace_back(m_star[k], t.vertices[0] == z   ? 0
+                                          : t.vertices[1] == z ? 1
+                                                               : 2);
+   }
+   flipEdges();
+
+   // The intersection is rounded, so it is not exactly on both edges. Insert it
+   // as vertex and connect both edges to it. The intersection might round to
+   // an existing vertex.
+   VertexIdx split = insert(intersection);
+   if (split == NoIdx)
+      split = vertexAt(intersection);
+   if (split == NoIdx || !insertSegment(x, split) || !insertSegment(split, y))
+      return NoIdx;
+   return split;
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::retriangulateCrossed(VertexIdx a, VertexIdx end)
+{
+   // Collect the edges of the triangles outside of the crossed triangles.
+   m_linkEdges.clear();
+   for (const TriangleIdx idx : m_crossed)
+      m_inCavity[idx] = true;
+   for (const TriangleIdx idx : m_crossed)
+   {
+      const MeshTriangle& t = m_triangles[idx];
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         if (!m_inCavity[t.neighbors[i]])
+         {
+            m_linkEdges.push_back(
+               {edgeKey(t.vertices[(i + 1) % 3], t.vertices[(i + 2) % 3]),
+                t.neighbors[i], 3, idx});
+         }
+      }
+   }
+
+   // Fill the polygons on both sides of the new edge. Both chains are given in
+   // the order from a to the end vertex.
+   m_newTriangles.clear();
+   triangulatePseudoPolygon(a, end, m_leftChain);
+   std::reverse(m_rightChain.begin(), m_rightChain.end());
+   triangulatePseudoPolygon(end, a, m_rightChain);
+
+   for (const TriangleIdx idx : m_newTriangles)
+   {
+      const MeshTriangle& t = m_triangles[idx];
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         m_linkEdges.push_back(
+            {edgeKey(t.vertices[(i + 1) % 3], t.vertices[(i + 2) % 3]), idx, i, NoIdx});
+      }
+   }
+
+   // Each edge is shared by exactly two triangles. New triangles come first for
+   // equal edges.
+   std::sort(m_linkEdges.begin(), m_linkEdges.end(),
+             [](const LinkEdge& e1, const LinkEdge& e2) {
+                return e1.key < e2.key || (e1.key == e2.key && e1.inner > e2.inner);
+             });
+   for (std::size_t i = 0; i + 1 < m_linkEdges.size(); i += 2)
+   {
+      const LinkEdge& e1 = m_linkEdges[i];
+      const LinkEdge& e2 = m_linkEdges[i + 1];
+      assert(e1.key == e2.key && e1.inner == NoIdx);
+      m_triangles[e1.idx].neighbors[e1.slot] = e2.idx;
+      if (e2.inner == NoIdx)
+         m_triangles[e2.idx].neighbors[e2.slot] = e1.idx;
+      else
+         replaceNeighbor(e2.idx, e2.inner, e1.idx);
+   }
+
+   for (const TriangleIdx idx : m_crossed)
+   {
+      removeTriangle(idx);
+      m_inCavity[idx] = false;
+   }
+   m_lastTriangle = m_newTriangles.back();
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::triangulatePseudoPolygon(VertexIdx p, VertexIdx q,
+                                               const std::vector<VertexIdx>& chain)
+{
+   m_polygonParts.clear();
+   m_polygonParts.push_back({p, q, 0, chain.size()});
+   while (!m_polygonParts.empty())
+   {
+      const PolygonPart part = m_polygonParts.back();
+      m_polygonParts.pop_back();
+      if (part.first == part.last)
+         continue;
+
+      // The chain vertex whose triangle with the edge has no other chain vertex
+      // in its circumcircle.
+      const Point2<T>& pp = m_vertices[part.p];
+      const Point2<T>& pq = m_vertices[part.q];
+      std::size_t c = part.first;
+      for (std::size_t i = part.first + 1; i < part.last; ++i)
+         if (inCircle(pp, pq, m_vertices[chain[c]], m_vertices[chain[i]]) > 0)
+            c = i;
+
+      m_newTriangles.push_back(addTriangle(part.p, part.q, chain[c]));
+      m_polygonParts.push_back({part.p, chain[c], part.first, c});
+      m_polygonParts.push_back({chain[c], part.q, c + 1, part.last});
+   }
+}
+
+
+template <typename T>
+std::pair<typename DelauneyMesh<T>::VertexIdx, typename DelauneyMesh<T>::VertexIdx>
+DelauneyMesh<T>::findConstrainedEdgeAt(TriangleIdx idx, const Point2<T>& pt) const
+{
+   const MeshTriangle& t = m_triangles[idx];
+   for (std::size_t i = 0; i < 3; ++i)
+   {
+      const VertexIdx from = t.vertices[(i + 1) % 3];
+      const VertexIdx to = t.vertices[(i + 2) % 3];
+      if (from != GhostVertex && to != GhostVertex && isConstrained(from, to) &&
+          orient2d(m_vertices[from], m_vertices[to], pt) == 0 &&
+          isBetween(pt, m_vertices[from], m_vertices[to]))
+      {
+         return {from, to};
+      }
+   }
+   return {NoIdx, NoIdx};
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::removeVertex(TriangleIdx container, VertexIdx vertex)
+{
+   findStar(container, vertex);
+
+   // Constrained edges at the vertex are lost. Forget them so that they don't
+   // apply to a vertex that reuses the slot.
+   if (!m_constraints.empty())
+      for (const HoleEdge& e : m_hole)
+         if (e.from != GhostVertex)
+            m_constraints.erase(edgeKey(vertex, e.from));
+
+   // When all solid triangles are around the vertex and the other vertices are
+   // on a line, no triangles are left after removing the vertex.
+   std::size_t numSolidInStar = 0;
+   for (const TriangleIdx idx : m_star)
+      numSolidInStar += isGhost(idx) ? 0 : 1;
+   if (numSolidInStar == m_numSolidTriangles && isHoleCollinear())
+   {
+      std::vector<VertexIdx> remaining;
+      for (const HoleEdge& e : m_hole)
+         if (e.from != GhostVertex)
+            remaining.push_back(e.from);
+      discardTriangles(remaining);
+      return;
+   }
+
+   fillHole();
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::TriangleIdx DelauneyMesh<T>::locate(const Point2<T>& pt,
+                                                              TriangleIdx start) const
+{
+   std::size_t numSteps = 0;
+   return walk(pt, start, numSteps);
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx DelauneyMesh<T>::vertexAt(const Point2<T>& pt) const
+{
+   if (!hasTriangles())
+   {
+      for (const VertexIdx v : m_pendingVertices)
+         if (isAt(v, pt))
+            return v;
+      return NoIdx;
+   }
+   return findVertex(locate(pt, m_lastTriangle), pt);
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::TriangleIdx
+DelauneyMesh<T>::walk(const Point2<T>& pt, TriangleIdx start, std::size_t& numSteps) const
+{
+   if (start == NoIdx || isRemoved(start))
+   {
+      numSteps = m_triangles.size();
+      return locateByScan(pt);
+   }
+
+   // Start the walk at the solid triangle of a ghost triangle's hull edge.
+   TriangleIdx current = start;
+   if (const std::size_t slot = ghostSlot(start); slot < 3)
+      current = m_triangles[start].neighbors[slot];
+
+   // Walk towards the point by crossing edges that the point is on the outside
+   // of. Rotating the first tested edge prevents cycling around the point for
+   // degenerate configurations. Crossing a hull edge leads into a ghost
+   // triangle, which ends the walk.
+   for (std::size_t step = 0; step <= m_triangles.size(); ++step)
+   {
+      numSteps = step + 1;
+      if (isGhost(current))
+         return current;
+
+      const MeshTriangle& t = m_triangles[current];
+
+      TriangleIdx next = NoIdx;
+      for (std::size_t k = 0; k < 3 && next == NoIdx; ++k)
+      {
+         const std::size_t i = (k + step) % 3;
+         if (orient2d(m_vertices[t.vertices[(i + 1) % 3]],
+                      m_vertices[t.vertices[(i + 2) % 3]], pt) < 0)
+         {
+            next = t.neighbors[i];
+         }
+      }
+
+      if (next == NoIdx)
+         return current;
+      current = next;
+   }
+
+   // The walk should always terminate for Delauney triangulations. Guard
+   // against numerical trouble anyway.
+   numSteps += m_triangles.size();
+   return locateByScan(pt);
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::TriangleIdx
+DelauneyMesh<T>::locateForInsertion(const Point2<T>& pt)
+{
+   ScopedStatsTimer<> timer{m_stats.locateSeconds};
+   std::size_t numSteps = 0;
+   const TriangleIdx idx = walk(pt, m_lastTriangle, numSteps);
+   if constexpr (DelauneyStatsEnabled)
+      m_stats.walkLengths.add(numSteps);
+   return idx;
+}
+
+
+template <typename T>
+template <typename V>
+void DelauneyMesh<T>::recordGrowth(const std::vector<V>& v, std::size_t& numAllocations)
+{
+   if constexpr (DelauneyStatsEnabled)
+   {
+      if (v.size() == v.capacity())
+         ++numAllocations;
+   }
+}
+
+
+template <typename T> std::vector<Triangle<T>> DelauneyMesh<T>::triangles() const
+{
+   std::vector<Triangle<T>> result;
+   triangles(result);
+   return result;
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::triangles(std::vector<Triangle<T>>& result,
+                                const std::vector<char>* selection) const
+{
+   result.clear();
+   result.reserve(m_numSolidTriangles);
+
+   for (TriangleIdx i = 0; i < m_triangles.size(); ++i)
+   {
+      if (isRemoved(i) || isGhost(i) || (selection && !(*selection)[i]))
+         continue;
+
+      const MeshTriangle& t = m_triangles[i];
+      result.emplace_back(m_vertices[t.vertices[0]], m_vertices[t.vertices[1]],
+                          m_vertices[t.vertices[2]]);
+   }
+}
+
+
+template <typename T>
+IndexedTriangulation<T> DelauneyMesh<T>::indexedTriangles(bool withNeighbors)
+{
+   IndexedTriangulation<T> result;
+   indexedTriangles(withNeighbors, result);
+   return result;
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::indexedTriangles(bool withNeighbors,
+                                       IndexedTriangulation<T>& result,
+                                       const std::vector<char>* selection)
+{
+   // Assign new indices to the triangles of the result and to the vertices that
+   // they reference. Vertices keep their relative order.
+   std::vector<TriangleIdx>& triangleMapping = m_triangleMapping;
+   std::vector<VertexIdx>& vertexMapping = m_vertexMapping;
+   triangleMapping.assign(m_triangles.size(), NoIdx);
+   vertexMapping.assign(m_vertices.size(), NoIdx);
+   TriangleIdx numTriangles = 0;
+   for (TriangleIdx i = 0; i < m_triangles.size(); ++i)
+   {
+      if (isRemoved(i) || isGhost(i) || (selection && !(*selection)[i]))
+         continue;
+
+      triangleMapping[i] = numTriangles++;
+      for (const VertexIdx v : m_triangles[i].vertices)
+         vertexMapping[v] = 0;
+   }
+
+   result.vertices.clear();
+   result.indices.clear();
+   result.neighbors.clear();
+   for (VertexIdx v = 0; v < m_vertices.size(); ++v)
+   {
+      if (vertexMapping[v] == NoIdx)
+         continue;
+      vertexMapping[v] = static_cast<VertexIdx>(result.vertices.size());
+      result.vertices.push_back(m_vertices[v]);
+   }
+
+   result.indices.reserve(3 * static_cast<std::size_t>(numTriangles));
+   if (withNeighbors)
+      result.neighbors.reserve(3 * static_cast<std::size_t>(numTriangles));
+
+   for (TriangleIdx i = 0; i < m_triangles.size(); ++i)
+   {
+      if (triangleMapping[i] == NoIdx)
+         continue;
+
+      const MeshTriangle& t = m_triangles[i];
+      for (const VertexIdx v : t.vertices)
+         result.indices.push_back(vertexMapping[v]);
+      if (withNeighbors)
+      {
+         // Ghost triangles and triangles that are not selected are not part of
+         // the result and map to NoIdx, which is the same value as
+         // IndexedTriangulation::NoNeighbor.
+         for (const TriangleIdx n : t.neighbors)
+            result.neighbors.push_back(triangleMapping[n]);
+      }
+   }
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx
+DelauneyMesh<T>::insertWithoutTriangles(const Point2<T>& pt)
+{
+   for (const VertexIdx v : m_pendingVertices)
+   {
+      if (isAt(v, pt))
+      {
+         if constexpr (DelauneyStatsEnabled)
+            ++m_stats.numDuplicatePoints;
+         return NoIdx;
+      }
+   }
+
+   const VertexIdx vertex = addVertex(pt);
+   if constexpr (DelauneyStatsEnabled)
+      ++m_stats.numInsertedPoints;
+
+   addPendingVertex(vertex);
+   return vertex;
+}
+
+
+template <typename T> void DelauneyMesh<T>::addPendingVertex(VertexIdx vertex)
+{
+   // All pending points are on the line through the first two of them.
+   if (m_pendingVertices.size() < 2 ||
+       orient2d(m_vertices[m_pendingVertices[0]], m_vertices[m_pendingVertices[1]],
+                m_vertices[vertex]) == 0)
+   {
+      if constexpr (DelauneyStatsEnabled)
+         ++m_stats.numPendingPoints;
+      m_pendingVertices.push_back(vertex);
+      return;
+   }
+
+   createFirstTriangle(m_pendingVertices[0], m_pendingVertices[1], vertex);
+
+   // The remaining pending points are on the hull or outside of it.
+   for (std::size_t i = 2; i < m_pendingVertices.size(); ++i)
+      insertVertex(m_pendingVertices[i]);
+   m_pendingVertices.clear();
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::createFirstTriangle(VertexIdx a, VertexIdx b, VertexIdx c)
+{
+   if (orient2d(m_vertices[a], m_vertices[b], m_vertices[c]) < 0)
+      std::swap(b, c);
+
+   // The ghost triangle of hull edge x->y is (y, x, ghost). Its neighbor across
+   // the hull edge is the solid triangle. Its other neighbors are the ghost
+   // triangles of the adjacent hull edges.
+   const TriangleIdx t = addTriangle(a, b, c);
+   const TriangleIdx ab = addTriangle(b, a, GhostVertex);
+   const TriangleIdx bc = addTriangle(c, b, GhostVertex);
+   const TriangleIdx ca = addTriangle(a, c, GhostVertex);
+
+   m_triangles[t].neighbors = {bc, ca, ab};
+   m_triangles[ab].neighbors = {ca, bc, t};
+   m_triangles[bc].neighbors = {ab, ca, t};
+   m_triangles[ca].neighbors = {bc, ab, t};
+
+   m_lastTriangle = t;
+}
+
+
+template <typename T> void DelauneyMesh<T>::insertVertex(VertexIdx vertex)
+{
+   const Point2<T>& pt = m_vertices[vertex];
+   findCavity(pt, locateForInsertion(pt));
+   fillCavity(vertex);
+}
+
+
+template <typename T>
+bool DelauneyMesh<T>::movePending(VertexIdx vertex, const Point2<T>& pt)
+{
+   const auto pos = std::find(m_pendingVertices.begin(), m_pendingVertices.end(), vertex);
+   if (pos == m_pendingVertices.end())
+      return false;
+   for (const VertexIdx v : m_pendingVertices)
+      if (v != vertex && isAt(v, pt))
+         return false;
+
+   m_pendingVertices.erase(pos);
+   m_vertices[vertex] = pt;
+   addPendingVertex(vertex);
+   return true;
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::discardTriangles(const std::vector<VertexIdx>& remainingVertices)
+{
+   m_triangles.clear();
+   m_freeTriangles.clear();
+   m_inCavity.clear();
+   m_numSolidTriangles = 0;
+   m_lastTriangle = NoIdx;
+   m_pendingVertices = remainingVertices;
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::findCavity(const Point2<T>& pt, TriangleIdx start)
+{
+   ScopedStatsTimer<> timer{m_stats.findCavitySeconds};
+   m_cavity.clear();
+   m_boundary.clear();
+
+   m_cavity.push_back(start);
+   m_inCavity[start] = true;
+
+   // Breadth-first search through the neighbors of cavity triangles. Besides
+   // the triangles whose circumcircle contains the point, also add triangles
+   // that would otherwise lead to a new solid triangle that is not ccw. This
+   // keeps the cavity star-shaped around the point in degenerate cases.
+   for (std::size_t c = 0; c < m_cavity.size(); ++c)
+   {
+      const TriangleIdx idx = m_cavity[c];
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         const MeshTriangle& t = m_triangles[idx];
+         const TriangleIdx neighbor = t.neighbors[i];
+         if (m_inCavity[neighbor])
+            continue;
+
+         const VertexIdx from = t.vertices[(i + 1) % 3];
+         const VertexIdx to = t.vertices[(i + 2) % 3];
+
+         // Constrained edges bound the cavity.
+         const bool isSolidEdge = from != GhostVertex && to != GhostVertex;
+         const bool isBlocked =
+            !m_constraints.empty() && isSolidEdge && isConstrained(from, to);
+         if (!isBlocked &&
+             (isInCircumcircle(neighbor, pt) ||
+              (isSolidEdge && !isGhost(neighbor) &&
+               orient2d(m_vertices[from], m_vertices[to], pt) <= 0)))
+         {
+            m_cavity.push_back(neighbor);
+            m_inCavity[neighbor] = true;
+         }
+         else
+         {
+            m_boundary.push_back({from, to, neighbor, idx});
+         }
+      }
+   }
+
+   // A neighbor that was rejected for one edge might have been added to the
+   // cavity for another edge. Such edges are inside the cavity.
+   std::size_t numKept = 0;
+   for (const BoundaryEdge& e : m_boundary)
+      if (!m_inCavity[e.outer])
+         m_boundary[numKept++] = e;
+   m_boundary.resize(numKept);
+
+   if constexpr (DelauneyStatsEnabled)
+   {
+      m_stats.cavitySizes.add(m_cavity.size());
+      m_stats.boundarySizes.add(m_boundary.size());
+   }
+}
+
+
+template <typename T> void DelauneyMesh<T>::fillCavity(VertexIdx vertex)
+{
+   ScopedStatsTimer<> timer{m_stats.fillCavitySeconds};
+
+   // Connect each outline edge to the new vertex.
+   // Edges that connect to the ghost vertex lead to ghost triangles for the new
+   // hull edges.
+   m_newTriangles.clear();
+   for (const BoundaryEdge& e : m_boundary)
+   {
+      const TriangleIdx idx = addTriangle(e.from, e.to, vertex);
+      m_newTriangles.push_back(idx);
+      m_triangles[idx].neighbors[2] = e.outer;
+      replaceNeighbor(e.outer, e.inner, idx);
+      triangleStartingAt(e.from) = idx;
+      if (!isGhost(idx))
+         m_lastTriangle = idx;
+   }
+
+   // Connect the new triangles with each other. The triangle across the edge
+   // from the end vertex of a triangle's outline edge to the new vertex is the
+   // triangle whose outline edge starts at that end vertex.
+   for (const TriangleIdx idx : m_newTriangles)
+   {
+      const TriangleIdx next = triangleStartingAt(m_triangles[idx].vertices[1]);
+      m_triangles[idx].neighbors[0] = next;
+      m_triangles[next].neighbors[1] = idx;
+   }
+
+   // Remove the cavity triangles. Their slots only get reused by later updates
+   // because the outline edges reference them to find the slots of the outer
+   // triangles that need to be updated.
+   for (const TriangleIdx idx : m_cavity)
+   {
+      removeTriangle(idx);
+      m_inCavity[idx] = false;
+   }
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::TriangleIdx DelauneyMesh<T>::addTriangle(VertexIdx a,
+                                                                   VertexIdx b,
+                                                                   VertexIdx c)
+{
+   if (a != GhostVertex && b != GhostVertex && c != GhostVertex)
+      ++m_numSolidTriangles;
+
+   if (!m_freeTriangles.empty())
+   {
+      const TriangleIdx idx = m_freeTriangles.back();
+      m_freeTriangles.pop_back();
+      m_triangles[idx] = MeshTriangle{{a, b, c}, {NoIdx, NoIdx, NoIdx}};
+      return idx;
+   }
+
+   recordGrowth(m_triangles, m_stats.numTriangleAllocations);
+   m_triangles.push_back(MeshTriangle{{a, b, c}, {NoIdx, NoIdx, NoIdx}});
+   m_inCavity.push_back(false);
+   return static_cast<TriangleIdx>(m_triangles.size() - 1);
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx DelauneyMesh<T>::addVertex(const Point2<T>& pt)
+{
+   if (!m_freeVertices.empty())
+   {
+      const VertexIdx idx = m_freeVertices.back();
+      m_freeVertices.pop_back();
+      m_vertices[idx] = pt;
+      return idx;
+   }
+
+   // The largest indices are reserved for the ghost vertex and NoIdx.
+   assert(m_vertices.size() < GhostVertex);
+   recordGrowth(m_vertices, m_stats.numVertexAllocations);
+   m_vertices.push_back(pt);
+   m_triangleStartingAt.push_back(NoIdx);
+   return static_cast<VertexIdx>(m_vertices.size() - 1);
+}
+
+
+template <typename T> void DelauneyMesh<T>::removeTriangle(TriangleIdx idx)
+{
+   if (!isGhost(idx))
+      --m_numSolidTriangles;
+   m_triangles[idx].vertices[0] = NoIdx;
+   m_freeTriangles.push_back(idx);
+}
+
+
+template <typename T> std::size_t DelauneyMesh<T>::ghostSlot(TriangleIdx idx) const
+{
+   const MeshTriangle& t = m_triangles[idx];
+   return t.vertices[0] == GhostVertex   ? 0
+          : t.vertices[1] == GhostVertex ? 1
+          : t.vertices[2] == GhostVertex ? 2
+                                         : 3;
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::TriangleIdx&
+DelauneyMesh<T>::triangleStartingAt(VertexIdx vertex)
+{
+   return vertex == GhostVertex ? m_ghostTriangleStartingAt
+                                : m_triangleStartingAt[vertex];
+}
+
+
+template <typename T>
+void DelauneyMesh<T>::replaceNeighbor(TriangleIdx idx, TriangleIdx oldNeighbor,
+                                      TriangleIdx newNeighbor)
+{
+   for (TriangleIdx& neighbor : m_triangles[idx].neighbors)
+   {
+      if (neighbor == oldNeighbor)
+      {
+         neighbor = newNeighbor;
+         return;
+      }
+   }
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::TriangleIdx
+DelauneyMesh<T>::locateByScan(const Point2<T>& pt) const
+{
+   for (TriangleIdx i = 0; i < m_triangles.size(); ++i)
+   {
+      if (isRemoved(i) || isGhost(i))
+         continue;
+
+      const MeshTriangle& t = m_triangles[i];
+      const Point2<T>& a = m_vertices[t.vertices[0]];
+      const Point2<T>& b = m_vertices[t.vertices[1]];
+      const Point2<T>& c = m_vertices[t.vertices[2]];
+      if (orient2d(a, b, pt) >= 0 && orient2d(b, c, pt) >= 0 &&
+          orient2d(c, a, pt) >= 0)
+      {
+         return i;
+      }
+   }
+
+   // The point is outside of the hull.
+   for (TriangleIdx i = 0; i < m_triangles.size(); ++i)
+   {
+      const std::size_t slot = ghostSlot(i);
+      if (isRemoved(i) || slot == 3)
+         continue;
+
+      const MeshTriangle& t = m_triangles[i];
+      if (orient2d(m_vertices[t.vertices[(slot + 1) % 3]],
+                   m_vertices[t.vertices[(slot + 2) % 3]], pt) > 0)
+      {
+         return i;
+      }
+   }
+
+   return m_lastTriangle;
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx DelauneyMesh<T>::findVertex(TriangleIdx idx,
+                                                               const Point2<T>& pt) const
+{
+   for (const VertexIdx v : m_triangles[idx].vertices)
+   {
+      if (v != GhostVertex && isAt(v, pt))
+         return v;
+   }
+   return NoIdx;
+}
+
+
+template <typename T> void DelauneyMesh<T>::findStar(TriangleIdx start, VertexIdx vertex)
+{
+   m_star.clear();
+   m_hole.clear();
+
+   // Walk ccw around the vertex. For a triangle (vertex, a, b) the next
+   // triangle is across the edge from b to the vertex.
+   TriangleIdx idx = start;
+   do
+   {
+      const MeshTriangle& t = m_triangles[idx];
+      const std::size_t i = t.vertices[0] == vertex ? 0 : t.vertices[1] == vertex ? 1 : 2;
+
+      // The edge opposite of the vertex is part of the outline. The slot of the
+      // outer triangle is only needed to fill the hole and is looked up there.
+      m_star.push_back(idx);
+      m_hole.push_back({t.vertices[(i + 1) % 3], t.neighbors[i], 3});
+      idx = t.neighbors[(i + 1) % 3];
+   } while (idx != start);
+}
+
+
+template <typename T> void DelauneyMesh<T>::fillHole()
+{
+   // Links a new triangle across its edge in a given slot to the triangle
+   // outside of a given outline edge.
+   const auto link = [this](TriangleIdx idx, std::size_t slot, const HoleEdge& e) {
+      m_triangles[idx].neighbors[slot] = e.outer;
+      m_triangles[e.outer].neighbors[e.outerSlot] = idx;
+   };
+
+   for (std::size_t k = 0; k < m_hole.size(); ++k)
+   {
+      HoleEdge& e = m_hole[k];
+      e.outerSlot = 0;
+      while (m_triangles[e.outer].neighbors[e.outerSlot] != m_star[k])
+         ++e.outerSlot;
+   }
+
+   // Clip ears until a single triangle is left. The outline has few vertices on
+   // average, so testing each candidate ear against all outline vertices is
+   // cheap.
+   while (m_hole.size() > 3)
+   {
+      const std::size_t n = m_hole.size();
+
+      std::size_t ear = 0;
+      while (ear < n && !isDelauneyEar(ear))
+         ++ear;
+      // Guard against numerical trouble.
+      if (ear == n)
+         ear = 0;
+
+      // Replace the outline edges from a to b and b to c with the edge from
+      // a to c.
+      const std::size_t second = (ear + 1) % n;
+      const HoleEdge& ab = m_hole[ear];
+      const HoleEdge& bc = m_hole[second];
+      const TriangleIdx idx = addTriangle(ab.from, bc.from, m_hole[(ear + 2) % n].from);
+      link(idx, 2, ab);
+      link(idx, 0, bc);
+
+      m_hole[ear] = {ab.from, idx, 1};
+      m_hole.erase(m_hole.begin() + second);
+   }
+
+   const TriangleIdx idx = addTriangle(m_hole[0].from, m_hole[1].from, m_hole[2].from);
+   link(idx, 2, m_hole[0]);
+   link(idx, 0, m_hole[1]);
+   link(idx, 1, m_hole[2]);
+
+   for (const TriangleIdx starIdx : m_star)
+      removeTriangle(starIdx);
+
+   // Continue later walks at a solid triangle next to the hole.
+   m_lastTriangle = isGhost(idx) ? m_triangles[idx].neighbors[ghostSlot(idx)] : idx;
+}
+
+
+template <typename T> bool DelauneyMesh<T>::isInStar(const Point2<T>& pt) const
+{
+   // Each star triangle (vertex, a, b) has to stay ccw with the vertex at the
+   // new point. Ghost triangles stay valid as long as the hull stays convex at
+   // the vertex and its hull neighbors.
+   const std::size_t n = m_hole.size();
+   for (std::size_t k = 0; k < n; ++k)
+   {
+      const VertexIdx a = m_hole[k].from;
+      const VertexIdx b = m_hole[(k + 1) % n].from;
+      if (a == GhostVertex)
+      {
+         // Ghost triangle of the hull edge from the vertex to b.
+         const Point2<T>& next = m_vertices[nextHullVertex(m_star[k])];
+         if (orient2d(pt, m_vertices[b], next) <= 0)
+            return false;
+      }
+      else if (b == GhostVertex)
+      {
+         // Ghost triangle of the hull edge from a to the vertex. The outline
+         // continues with the hull vertex after the vertex.
+         const Point2<T>& prev = m_vertices[prevHullVertex(m_star[k])];
+         const Point2<T>& next = m_vertices[m_hole[(k + 2) % n].from];
+         if (orient2d(prev, m_vertices[a], pt) <= 0 ||
+             orient2d(m_vertices[a], pt, next) <= 0)
+         {
+            return false;
+         }
+      }
+      else if (orient2d(m_vertices[a], m_vertices[b], pt) <= 0)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx DelauneyMesh<T>::prevHullVertex(TriangleIdx ghost) const
+{
+   // The ghost triangle of hull edge x->y is (y, x, ghost). The ghost triangle
+   // of the previous hull edge is across the edge from x to the ghost vertex.
+   const std::size_t slot = ghostSlot(ghost);
+   const TriangleIdx prev = m_triangles[ghost].neighbors[(slot + 1) % 3];
+   return m_triangles[prev].vertices[(ghostSlot(prev) + 2) % 3];
+}
+
+
+template <typename T>
+typename DelauneyMesh<T>::VertexIdx DelauneyMesh<T>::nextHullVertex(TriangleIdx ghost) const
+{
+   const std::size_t slot = ghostSlot(ghost);
+   const TriangleIdx next = m_triangles[ghost].neighbors[(slot + 2) % 3];
+   return m_triangles[next].vertices[(ghostSlot(next) + 1) % 3];
+}
+
+
+template <typename T> void DelauneyMesh<T>::flipStarEdges()
+{
+   // Moving the vertex changes the circumcircles of its triangles. Only their
+   // edges can violate the Delauney condition at first. For a star triangle
+   // (vertex, a, b) check the outline edge from a to b and the edge from b to
+   // the vertex. The edge from the vertex to a is checked by the previous
+   // triangle.
+   m_flipStack.clear();
+   for (std::size_t k = 0; k < m_star.size(); ++k)
+   {
+      const TriangleIdx idx = m_star[k];
+      if (isGhost(idx))
+         continue;
+      const MeshTriangle& t = m_triangles[idx];
+      const std::size_t i = t.vertices[0] == m_hole[k].from   ? 2
+                            : t.vertices[1] == m_hole[k].from ? 0
+                                                              : 1;
+      m_flipStack.emplace_back(idx, i);
+      m_flipStack.emplace_back(idx, (i + 1) % 3);
+   }
+
+   flipEdges();
+}
+
+
+template <typename T> void DelauneyMesh<T>::flipEdges()
+{
+   // Lawson's algorithm. Each flip can only make the outer edges of the
+   // flipped quadrilateral violate the condition.
+   while (!m_flipStack.empty())
+   {
+      const auto [idx, slot] = m_flipStack.back();
+      m_flipStack.pop_back();
+      if (isFlippable(idx, slot))
+         flip(idx, slot);
+   }
+}
+
+
+template <typename T>
+bool DelauneyMesh<T>::isFlippable(TriangleIdx idx, std::size_t slot) const
+{
+   const MeshTriangle& t = m_triangles[idx];
+   const TriangleIdx neighborIdx = t.neighbors[slot];
+   if (isGhost(idx) || isGhost(neighborIdx))
+      return false;
+   if (!m_constraints.empty() &&
+       isConstrained(t.vertices[(slot + 1) % 3], t.vertices[(slot + 2) % 3]))
+   {
+      return false;
+   }
+
+   const MeshTriangle& neighbor = m_triangles[neighborIdx];
+   std::size_t opposite = 0;
+   while (neighbor.neighbors[opposite] != idx)
+      ++opposite;
+
+   return inCircle(m_vertices[t.vertices[0]], m_vertices[t.vertices[1]],
+                   m_vertices[t.vertices[2]],
+                   m_vertices[neighbor.vertices[opposite]]) > 0;
+}
+
+
+template <typename T> void DelauneyMesh<T>::flip(TriangleIdx idx, std::size_t slot)
+{
+   // The triangle is (c, a, b) and its neighbor across the edge from a to b is
+   // (d, b, a). They get replaced by (c, a, d) and (d, b, c) in the same slots.
+   const TriangleIdx neighborIdx = m_triangles[idx].neighbors[slot];
+   MeshTriangle& t = m_triangles[idx];
+   MeshTriangle& neighbor = m_triangles[neighborIdx];
+   std::size_t opposite = 0;
+   while (neighbor.neighbors[opposite] != idx)
+      ++opposite;
+
+   const VertexIdx c = t.vertices[slot];
+   const VertexIdx a = t.vertices[(slot + 1) % 3];
+   const VertexIdx b = t.vertices[(slot + 2) % 3];
+   const VertexIdx d = neighbor.vertices[opposite];
+   const TriangleIdx acrossBc = t.neighbors[(slot + 1) % 3];
+   const TriangleIdx acrossCa = t.neighbors[(slot + 2) % 3];
+   const TriangleIdx acrossAd = neighbor.neighbors[(opposite + 1) % 3];
+   const TriangleIdx acrossDb = neighbor.neighbors[(opposite + 2) % 3];
+
+   t = MeshTriangle{{c, a, d}, {acrossAd, neighborIdx, acrossCa}};
+   neighbor = MeshTriangle{{d, b, c}, {acrossBc, idx, acrossDb}};
+   replaceNeighbor(acrossAd, neighborIdx, idx);
+   replaceNeighbor(acrossBc, idx, neighborIdx);
+
+   if constexpr (DelauneyStatsEnabled)
+      ++m_stats.numFlips;
+
+   m_flipStack.emplace_back(idx, 0);
+   m_flipStack.emplace_back(idx, 2);
+   m_flipStack.emplace_back(neighborIdx, 0);
+   m_flipStack.emplace_back(neighborIdx, 2);
+}
+
+
+template <typename T> bool DelauneyMesh<T>::isHoleCollinear() const
+{
+   const HoleEdge* first = nullptr;
+   const HoleEdge* second = nullptr;
+   for (const HoleEdge& e : m_hole)
+   {
+      if (e.from == GhostVertex)
+         continue;
+      if (!first)
+         first = &e;
+      else if (!second)
+         second = &e;
+      else if (orient2d(m_vertices[first->from], m_vertices[second->from],
+                        m_vertices[e.from]) != 0)
+         return false;
+   }
+   return true;
+}
+
+
+template <typename T>
+bool DelauneyMesh<T>::isInCircumcircle(TriangleIdx idx, const Point2<T>& pt) const
+{
+   const MeshTriangle& t = m_triangles[idx];
+
+   const std::size_t slot = ghostSlot(idx);
+   if (slot < 3)
+   {
+      const Point2<T>& a = m_vertices[t.vertices[(slot + 1) % 3]];
+      const Point2<T>& b = m_vertices[t.vertices[(slot + 2) % 3]];
+      const auto orientation = orient2d(a, b, pt);
+      return orientation > 0 || (orientation == 0 && isBetween(pt, a, b));
+   }
+
+   const Point2<T>& a = m_vertices[t.vertices[0]];
+   const Point2<T>& b = m_vertices[t.vertices[1]];
+   const Point2<T>& c = m_vertices[t.vertices[2]];
+   return inCircle(a, b, c, pt) > 0;
+}
+
+
+template <typename T> bool DelauneyMesh<T>::isDelauneyEar(std::size_t first) const
+{
+   const std::size_t n = m_hole.size();
+   std::array<VertexIdx, 3> ear = {m_hole[first].from, m_hole[(first + 1) % n].from,
+                                   m_hole[(first + 2) % n].from};
+
+   const auto ghostPos = std::find(ear.begin(), ear.end(), GhostVertex);
+   if (ghostPos != ear.end())
+   {
+      // The ear is a ghost triangle. Its hull edge must have all other outline
+      // vertices on its inner side.
+      std::rotate(ear.begin(), ghostPos + 1, ear.end());
+      const Point2<T>& a = m_vertices[ear[0]];
+      const Point2<T>& b = m_vertices[ear[1]];
+      for (std::size_t k = 3; k < n; ++k)
+      {
+         const VertexIdx v = m_hole[(first + k) % n].from;
+         const auto orientation = orient2d(a, b, m_vertices[v]);
+         if (orientation > 0 || (orientation == 0 && isBetween(m_vertices[v], a, b)))
+            return false;
+      }
+      return true;
+   }
+
+   const Point2<T>& a = m_vertices[ear[0]];
+   const Point2<T>& b = m_vertices[ear[1]];
+   const Point2<T>& c = m_vertices[ear[2]];
+   if (orient2d(a, b, c) <= 0)
+      return false;
+
+   for (std::size_t k = 3; k < n; ++k)
+   {
+      const VertexIdx v = m_hole[(first + k) % n].from;
+      if (v != GhostVertex && inCircle(a, b, c, m_vertices[v]) > 0)
+         return false;
+   }
+   return true;
+}
+
+
+template <typename T>
+bool DelauneyMesh<T>::isBetween(const Point2<T>& pt, const Point2<T>& a,
+                                const Point2<T>& b)
+{
+   // For points on the line through a and b it is enough to compare the
+   // coordinates along the axis that the line is not perpendicular to.
+   if (a.x() != b.x())
+      return (a.x() < pt.x() && pt.x() < b.x()) || (b.x() < pt.x() && pt.x() < a.x());
+   return (a.y() < pt.y() && pt.y() < b.y()) || (b.y() < pt.y() && pt.y() < a.y());
+}
+
+
+template <typename T>
+bool DelauneyMesh<T>::isAhead(const Point2<T>& pt, const Point2<T>& a, const Point2<T>& b)
+{
+   if (a.x() != b.x())
+      return (pt.x() > a.x()) == (b.x() > a.x());
+   return (pt.y() > a.y()) == (b.y() > a.y());
+}
+
+} // namespace internals
+} // namespace geom
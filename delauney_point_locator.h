@@ -0,0 +1,535 @@
+//
+// geomcpp
+// Point location queries on a finished Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "geom_util.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Answers point location queries on a Delauney triangulation:
+// - Finding the triangle that contains a point uses jump-and-walk. A uniform
+//   grid over the vertices stores a triangle near the center of each cell. A
+//   query jumps to the triangle of its cell and walks through the neighbors of
+//   triangles towards the point.
+// - Finding the nearest vertex starts at the closest vertex of the located
+//   triangle and moves to closer adjacent vertices until none is closer. In a
+//   Delauney triangulation this ends at the nearest vertex.
+// Batched queries continue each walk from the result of the previous query if
+// both queries fall into the same grid cell, so spatially sorted queries take
+// short walks.
+// Queries don't modify the locator, so any number of threads can query the
+// same locator concurrently. Batched queries can also split their points
+// across multiple threads themselves.
+// The triangulation has to cover the convex hull of its vertices, which
+// Delauney triangulations do.
+template <typename T> class DelauneyPointLocator
+{
+ public:
+   using Idx = std::uint32_t;
+   // Result for points outside of the triangulation or for empty
+   // triangulations.
+   static constexpr Idx NoIdx = std::numeric_limits<Idx>::max();
+
+   // Builds the search structures for a given triangulation. Calculates the
+   // neighbors of the triangles if the triangulation does not include them.
+   explicit DelauneyPointLocator(IndexedTriangulation<T> triangulation);
+
+   const IndexedTriangulation<T>& triangulation() const { return m_triangulation; }
+
+   // Returns the index of a triangle that contains a given point. Points on
+   // shared edges or vertices can be reported for any of the adjacent
+   // triangles. Returns NoIdx for points outside of the triangulation.
+   Idx locate(const Point2<T>& pt) const;
+   // Returns the index of the vertex that is closest to a given point. Returns
+   // NoIdx for empty triangulations.
+   Idx nearestVertex(const Point2<T>& pt) const;
+
+   // Batched versions of the queries. Store the result for each point at the
+   // same position in a given result vector. Each thread handles a consecutive
+   // range of the points, so the result does not depend on the number of
+   // threads.
+   void locate(const std::vector<Point2<T>>& points, std::vector<Idx>& result,
+               std::size_t numThreads = 1) const;
+   void nearestVertex(const std::vector<Point2<T>>& points, std::vector<Idx>& result,
+                      std::size_t numThreads = 1) const;
+
+ private:
+   // Minimal number of queries that are worth running on a separate thread.
+   static constexpr std::size_t MinParallelQueries = 10000;
+
+   // Result of walking towards a point.
+   struct WalkResult
+   {
+      // Triangle that contains the point or, for points outside of the
+      // triangulation, the hull triangle that the walk stopped at.
+      Idx triangle;
+      bool isInside;
+   };
+
+   // Walks from a given triangle to the triangle that contains a given point.
+   WalkResult walk(const Point2<T>& pt, Idx start) const;
+   // Runs a given batched query for ranges of given points on multiple threads.
+   template <typename Query>
+   void runBatch(const std::vector<Point2<T>>& points, std::vector<Idx>& result,
+                 std::size_t numThreads, Query query) const;
+   // Batched queries for the points in the range [first, last).
+   void locate(const std::vector<Point2<T>>& points, std::size_t first,
+               std::size_t last, std::vector<Idx>& result) const;
+   void nearestVertex(const std::vector<Point2<T>>& points, std::size_t first,
+                      std::size_t last, std::vector<Idx>& result) const;
+   // Finds the triangle that contains a given point by checking all triangles.
+   WalkResult locateByScan(const Point2<T>& pt) const;
+   // Moves from the closest vertex of a given triangle to closer vertices until
+   // it reaches the vertex that is closest to a given point.
+   Idx descendToNearest(const Point2<T>& pt, Idx triangle) const;
+   // Returns the triangle that walks for a given point start at.
+   Idx startTriangle(const Point2<T>& pt) const;
+   // Returns the vertex at a given position of a triangle.
+   const Point2<T>& vertex(Idx triangle, std::size_t pos) const
+   {
+      return m_triangulation.vertices[m_triangulation.indices[3 * triangle + pos]];
+   }
+
+   void buildNeighbors();
+   void buildVertexAdjacency();
+   void buildGrid();
+   // Returns the grid cell that contains a given point. Points outside of the
+   // grid are assigned to the closest cell.
+   std::size_t cellOf(const Point2<T>& pt) const;
+
+ private:
+   IndexedTriangulation<T> m_triangulation;
+   // Adjacent vertices of each vertex. The adjacent vertices of vertex i are in
+   // the range [m_adjacencyStart[i], m_adjacencyStart[i+1]).
+   std::vector<Idx> m_adjacencyStart;
+   std::vector<Idx> m_adjacency;
+   // Grid of start triangles for walks.
+   T m_gridLeft = T(0);
+   T m_gridTop = T(0);
+   T m_invCellWidth = T(0);
+   T m_invCellHeight = T(0);
+   std::size_t m_numCellsX = 1;
+   std::size_t m_numCellsY = 1;
+   std::vector<Idx> m_cellTriangles;
+};
+
+
+template <typename T>
+DelauneyPointLocator<T>::DelauneyPointLocator(IndexedTriangulation<T> triangulation)
+: m_triangulation{std::move(triangulation)}
+{
+   if (!m_triangulation.hasNeighbors())
+      buildNeighbors();
+   buildVertexAdjacency();
+   buildGrid();
+}
+
+
+template <typename T>
+typename DelauneyPointLocator<T>::Idx
+DelauneyPointLocator<T>::locate(const Point2<T>& pt) const
+{
+   if (m_triangulation.numTriangles() == 0)
+      return NoIdx;
+
+   const WalkResult located = walk(pt, startTriangle(pt));
+   return located.isInside ? located.triangle : NoIdx;
+}
+
+
+template <typename T>
+typename DelauneyPointLocator<T>::Idx
+DelauneyPointLocator<T>::nearestVertex(const Point2<T>& pt) const
+{
+   if (m_triangulation.numTriangles() == 0)
+      return NoIdx;
+
+   // The walk ends close to the point even if it is outside.
+   return descendToNearest(pt, walk(pt, startTriangle(pt)).triangle);
+}
+
+
+template <typename T>
+void DelauneyPointLocator<T>::locate(const std::vector<Point2<T>>& points,
+                                     std::vector<Idx>& result,
+                                     std::size_t numThreads) const
+{
+   runBatch(points, result, numThreads, [&](std::size_t first, std::size_t last) {
+      locate(points, first, last, result);
+   });
+}
+
+
+template <typename T>
+void DelauneyPointLocator<T>::nearestVertex(const std::vector<Point2<T>>& points,
+                                            std::vector<Idx>& result,
+                                            std::size_t numThreads) const
+{
+   runBatch(points, result, numThreads, [&](std::size_t first, std::size_t last) {
+      nearestVertex(points, first, last, result);
+   });
+}
+
+
+template <typename T>
+template <typename Query>
+void DelauneyPointLocator<T>::runBatch(const std::vector<Point2<T>>& points,
+                                       std::vector<Idx>& result, std::size_t numThreads,
+                                       Query query) const
+{
+   result.resize(points.size());
+   if (m_triangulation.numTriangles() == 0)
+   {
+      std::fill(result.begin(), result.end(), NoIdx);
+      return;
+   }
+
+   const std::size_t numPoints = points.size();
+   numThreads = std::clamp<std::size_t>(numPoints / MinParallelQueries, 1,
+                                        std::max<std::size_t>(numThreads, 1));
+
+   std::vector<std::future<void>> threads;
+   for (std::size_t i = 1; i < numThreads; ++i)
+   {
+      threads.push_back(std::async(std::launch::async, [&, i]() {
+         query(i * numPoints / numThreads, (i + 1) * numPoints / numThreads);
+      }));
+   }
+   query(0, numPoints / numThreads);
+   for (auto& thread : threads)
+      thread.get();
+}
+
+
+template <typename T>
+void DelauneyPointLocator<T>::locate(const std::vector<Point2<T>>& points,
+                                     std::size_t first, std::size_t last,
+                                     std::vector<Idx>& result) const
+{
+   std::size_t prevCell = m_cellTriangles.size();
+   Idx prev = NoIdx;
+   for (std::size_t i = first; i < last; ++i)
+   {
+      const std::size_t cell = cellOf(points[i]);
+      const WalkResult located =
+         walk(points[i], cell == prevCell ? prev : m_cellTriangles[cell]);
+      result[i] = located.isInside ? located.triangle : NoIdx;
+      prev = located.triangle;
+      prevCell = cell;
+   }
+}
+
+
+template <typename T>
+void DelauneyPointLocator<T>::nearestVertex(const std::vector<Point2<T>>& points,
+                                            std::size_t first, std::size_t last,
+                                            std::vector<Idx>& result) const
+{
+   std::size_t prevCell = m_cellTriangles.size();
+   Idx prev = NoIdx;
+   for (std::size_t i = first; i < last; ++i)
+   {
+      const std::size_t cell = cellOf(points[i]);
+      prev = walk(points[i], cell == prevCell ? prev : m_cellTriangles[cell]).triangle;
+      result[i] = descendToNearest(points[i], prev);
+      prevCell = cell;
+   }
+}
+
+
+template <typename T>
+typename DelauneyPointLocator<T>::WalkResult
+DelauneyPointLocator<T>::walk(const Point2<T>& pt, Idx start) const
+{
+   const std::vector<Idx>& neighbors = m_triangulation.neighbors;
+   const std::size_t numTriangles = m_triangulation.numTriangles();
+
+   // Cross edges that the point is on the outside of. Rotating the first tested
+   // edge prevents cycling around the point for degenerate configurations.
+   // Being outside of an edge without neighbor means that the point is outside
+   // of the convex hull.
+   Idx current = start;
+   for (std::size_t step = 0; step <= numTriangles; ++step)
+   {
+      Idx next = NoIdx;
+      for (std::size_t k = 0; k < 3 && next == NoIdx; ++k)
+      {
+         const std::size_t i = (k + step) % 3;
+         if (orient2d(vertex(current, (i + 1) % 3), vertex(current, (i + 2) % 3), pt) < 0)
+         {
+            next = neighbors[3 * current + i];
+            if (next == IndexedTriangulation<T>::NoNeighbor)
+               return {current, false};
+         }
+      }
+
+      if (next == NoIdx)
+         return {current, true};
+      current = next;
+   }
+
+   // The walk should always terminate for Delauney triangulations. Guard
+   // against numerical trouble anyway.
+   return locateByScan(pt);
+}
+
+
+template <typename T>
+typename DelauneyPointLocator<T>::WalkResult
+DelauneyPointLocator<T>::locateByScan(const Point2<T>& pt) const
+{
+   const Idx numTriangles = static_cast<Idx>(m_triangulation.numTriangles());
+   for (Idx t = 0; t < numTriangles; ++t)
+   {
+      if (orient2d(vertex(t, 0), vertex(t, 1), pt) >= 0 &&
+          orient2d(vertex(t, 1), vertex(t, 2), pt) >= 0 &&
+          orient2d(vertex(t, 2), vertex(t, 0), pt) >= 0)
+      {
+         return {t, true};
+      }
+   }
+   return {0, false};
+}
+
+
+template <typename T>
+typename DelauneyPointLocator<T>::Idx
+DelauneyPointLocator<T>::descendToNearest(const Point2<T>& pt, Idx triangle) const
+{
+   const std::vector<Point2<T>>& vertices = m_triangulation.vertices;
+   const auto distSquared = [&pt, &vertices](Idx v) {
+      const T dx = vertices[v].x() - pt.x();
+      const T dy = vertices[v].y() - pt.y();
+      return dx * dx + dy * dy;
+   };
+
+   Idx nearest = m_triangulation.indices[3 * triangle];
+   T nearestDist = distSquared(nearest);
+   for (std::size_t i = 1; i < 3; ++i)
+   {
+      const Idx v = m_triangulation.indices[3 * triangle + i];
+      const T dist = distSquared(v);
+      if (dist < nearestDist)
+      {
+         nearest = v;
+         nearestDist = dist;
+      }
+   }
+
+   // Greedy descent through the adjacent vertices.
+   for (bool hasMoved = true; hasMoved;)
+   {
+      hasMoved = false;
+      const Idx last = m_adjacencyStart[nearest + 1];
+      for (Idx i = m_adjacencyStart[nearest]; i < last; ++i)
+      {
+         const Idx v = m_adjacency[i];
+         const T dist = distSquared(v);
+         if (dist < nearestDist)
+         {
+            nearest = v;
+            nearestDist = dist;
+            hasMoved = true;
+         }
+      }
+   }
+
+   return nearest;
+}
+
+
+template <typename T>
+typename DelauneyPointLocator<T>::Idx
+DelauneyPointLocator<T>::startTriangle(const Point2<T>& pt) const
+{
+   return m_cellTriangles[cellOf(pt)];
+}
+
+
+template <typename T> void DelauneyPointLocator<T>::buildNeighbors()
+{
+   const std::vector<Idx>& indices = m_triangulation.indices;
+
+   // Sort the edges by their vertices. Each edge is stored as its start and end
+   // vertex and its position in the index buffer.
+   struct Edge
+   {
+      Idx from;
+      Idx to;
+      Idx pos;
+   };
+   std::vector<Edge> edges;
+   edges.reserve(indices.size());
+   for (Idx t = 0; t < m_triangulation.numTriangles(); ++t)
+   {
+      // The edge opposite of vertex i goes from vertex i+1 to i+2.
+      for (Idx i = 0; i < 3; ++i)
+         edges.push_back({indices[3 * t + (i + 1) % 3], indices[3 * t + (i + 2) % 3],
+                          3 * t + i});
+   }
+   const auto edgeLess = [](const Edge& a, const Edge& b) {
+      return a.from < b.from || (a.from == b.from && a.to < b.to);
+   };
+   std::sort(edges.begin(), edges.end(), edgeLess);
+
+   // The neighbor across an edge contains the edge in reverse direction.
+   m_triangulation.neighbors.assign(indices.size(), IndexedTriangulation<T>::NoNeighbor);
+   for (const Edge& e : edges)
+   {
+      const auto twin =
+         std::lower_bound(edges.begin(), edges.end(), Edge{e.to, e.from, 0}, edgeLess);
+      if (twin != edges.end() && twin->from == e.to && twin->to == e.from)
+         m_triangulation.neighbors[e.pos] = twin->pos / 3;
+   }
+}
+
+
+template <typename T> void DelauneyPointLocator<T>::buildVertexAdjacency()
+{
+   const std::vector<Idx>& indices = m_triangulation.indices;
+   const std::vector<Idx>& neighbors = m_triangulation.neighbors;
+
+   // Each edge between two triangles appears in both directions. Edges on the
+   // hull only appear in one direction and also get added in reverse.
+   const auto forEachEdge = [&indices, &neighbors](auto fn) {
+      for (std::size_t pos = 0; pos < indices.size(); ++pos)
+      {
+         const std::size_t first = pos - pos % 3;
+         const Idx from = indices[first + (pos + 1) % 3];
+         const Idx to = indices[first + (pos + 2) % 3];
+         fn(from, to);
+         if (neighbors[pos] == IndexedTriangulation<T>::NoNeighbor)
+            fn(to, from);
+      }
+   };
+
+   m_adjacencyStart.assign(m_triangulation.vertices.size() + 1, 0);
+   forEachEdge([this](Idx from, Idx) { ++m_adjacencyStart[from + 1]; });
+   for (std::size_t i = 1; i < m_adjacencyStart.size(); ++i)
+      m_adjacencyStart[i] += m_adjacencyStart[i - 1];
+
+   std::vector<Idx> next(m_adjacencyStart.begin(), m_adjacencyStart.end() - 1);
+   m_adjacency.resize(m_adjacencyStart.back());
+   forEachEdge([this, &next](Idx from, Idx to) { m_adjacency[next[from]++] = to; });
+}
+
+
+template <typename T> void DelauneyPointLocator<T>::buildGrid()
+{
+   const std::vector<Point2<T>>& vertices = m_triangulation.vertices;
+   const auto bounds = calcPathBounds<T>(vertices.begin(), vertices.end());
+   if (!bounds || m_triangulation.numTriangles() == 0)
+      return;
+
+   // About four vertices per cell keep the walks short without making the grid
+   // large.
+   const T width = bounds->width();
+   const T height = bounds->height();
+   const double numCells = std::max(static_cast<double>(vertices.size()) / 4.0, 1.0);
+   const double aspect = static_cast<double>(width) / static_cast<double>(height);
+   m_numCellsX = std::max<std::size_t>(
+      static_cast<std::size_t>(std::ceil(std::sqrt(numCells * aspect))), 1);
+   m_numCellsY = std::max<std::size_t>(
+      static_cast<std::size_t>(std::ceil(numCells / m_numCellsX)), 1);
+   m_gridLeft = bounds->left();
+   m_gridTop = bounds->top();
+   m_invCellWidth = static_cast<T>(m_numCellsX) / width;
+   m_invCellHeight = static_cast<T>(m_numCellsY) / height;
+
+   // For each vertex a triangle that it belongs to.
+   std::vector<Idx> vertexTriangles(vertices.size(), NoIdx);
+   for (std::size_t pos = 0; pos < m_triangulation.indices.size(); ++pos)
+      vertexTriangles[m_triangulation.indices[pos]] = static_cast<Idx>(pos / 3);
+
+   // Each cell starts at a triangle of the vertex that is closest to the cell's
+   // center.
+   const std::size_t numGridCells = m_numCellsX * m_numCellsY;
+   m_cellTriangles.assign(numGridCells, NoIdx);
+   std::vector<T> cellDists(numGridCells, std::numeric_limits<T>::max());
+   for (Idx v = 0; v < vertices.size(); ++v)
+   {
+      if (vertexTriangles[v] == NoIdx)
+         continue;
+
+      const std::size_t cell = cellOf(vertices[v]);
+      const T centerX = m_gridLeft + (static_cast<T>(cell % m_numCellsX) + T(0.5)) /
+                                        m_invCellWidth;
+      const T centerY = m_gridTop + (static_cast<T>(cell / m_numCellsX) + T(0.5)) /
+                                       m_invCellHeight;
+      const T dx = vertices[v].x() - centerX;
+      const T dy = vertices[v].y() - centerY;
+      const T dist = dx * dx + dy * dy;
+      if (dist < cellDists[cell])
+      {
+         cellDists[cell] = dist;
+         m_cellTriangles[cell] = vertexTriangles[v];
+      }
+   }
+
+   // Empty cells inherit the start triangle of an adjacent cell in breadth-first
+   // order, so that they start close by.
+   std::vector<std::size_t> queue;
+   queue.reserve(numGridCells);
+   for (std::size_t cell = 0; cell < numGridCells; ++cell)
+      if (m_cellTriangles[cell] != NoIdx)
+         queue.push_back(cell);
+
+   for (std::size_t q = 0; q < queue.size(); ++q)
+   {
+      const std::size_t cell = queue[q];
+      const std::size_t x = cell % m_numCellsX;
+      const std::size_t y = cell / m_numCellsX;
+      const auto visit = [this, &queue, cell](std::size_t adjacent) {
+         if (m_cellTriangles[adjacent] == NoIdx)
+         {
+            m_cellTriangles[adjacent] = m_cellTriangles[cell];
+            queue.push_back(adjacent);
+         }
+      };
+      if (x > 0)
+         visit(cell - 1);
+      if (x + 1 < m_numCellsX)
+         visit(cell + 1);
+      if (y > 0)
+         visit(cell - m_numCellsX);
+      if (y + 1 < m_numCellsY)
+         visit(cell + m_numCellsX);
+   }
+}
+
+
+template <typename T>
+std::size_t DelauneyPointLocator<T>::cellOf(const Point2<T>& pt) const
+{
+   const auto cellPos = [](T coord, T gridMin, T invCellSize, std::size_t numCells) {
+      const T pos = std::floor((coord - gridMin) * invCellSize);
+      if (!(pos > T(0)))
+         return std::size_t(0);
+      if (pos >= static_cast<T>(numCells - 1))
+         return numCells - 1;
+      return static_cast<std::size_t>(pos);
+   };
+
+   return cellPos(pt.y(), m_gridTop, m_invCellHeight, m_numCellsY) * m_numCellsX +
+          cellPos(pt.x(), m_gridLeft, m_invCellWidth, m_numCellsX);
+}
+
+} // namespace geom
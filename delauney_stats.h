@@ -0,0 +1,140 @@
+//
+// geomcpp
+// Statistics about Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+
+namespace geom
+{
+///////////////////
+
+// Collecting statistics is opt-in. Define GEOM_DELAUNEY_STATS for all
+// translation units of a program to enable it. Otherwise the recording code is
+// compiled out and the statistics stay empty.
+#if defined(GEOM_DELAUNEY_STATS)
+inline constexpr bool DelauneyStatsEnabled = true;
+#else
+inline constexpr bool DelauneyStatsEnabled = false;
+#endif
+
+
+///////////////////
+
+// Histogram of counts with buckets of exponentially growing size. Bucket 0
+// counts the values 0 and 1, bucket i counts the values in [2^i, 2^(i+1)). The
+// last bucket also counts all larger values.
+struct DelauneyHistogram
+{
+   static constexpr std::size_t NumBuckets = 16;
+
+   void add(std::size_t value)
+   {
+      std::size_t bucket = 0;
+      for (std::size_t v = value; v > 1 && bucket < NumBuckets - 1; v >>= 1)
+         ++bucket;
+      ++buckets[bucket];
+      ++numValues;
+      sum += value;
+      if (value > max)
+         max = value;
+   }
+
+   double mean() const
+   {
+      return numValues > 0 ? static_cast<double>(sum) / static_cast<double>(numValues)
+                           : 0.0;
+   }
+
+   std::array<std::size_t, NumBuckets> buckets{};
+   std::size_t numValues = 0;
+   std::size_t sum = 0;
+   std::size_t max = 0;
+};
+
+
+// Statistics of the Bowyer-Watson algorithm. Only collected when
+// GEOM_DELAUNEY_STATS is defined.
+struct DelauneyStats
+{
+   // Time spent in each phase in seconds.
+   // Sorting the points into insertion order.
+   double sortSeconds = 0.0;
+   // Walking through the mesh to the triangle that contains a point.
+   double locateSeconds = 0.0;
+   // Collecting the triangles whose circumcircle contains a point.
+   double findCavitySeconds = 0.0;
+   // Replacing the cavity triangles with triangles around the new point.
+   double fillCavitySeconds = 0.0;
+   // Collecting the resulting triangles from the mesh.
+   double outputSeconds = 0.0;
+
+   std::size_t numInsertedPoints = 0;
+   // Points that were skipped because they coincide with an existing point.
+   std::size_t numDuplicatePoints = 0;
+   // Points that were collected before the mesh had any triangles.
+   std::size_t numPendingPoints = 0;
+
+   // Triangles visited while locating each point.
+   DelauneyHistogram walkLengths;
+   // Triangles removed by each insertion, including ghost triangles.
+   DelauneyHistogram cavitySizes;
+   // Outline edges of each cavity, i.e. triangles created by each insertion.
+   DelauneyHistogram boundarySizes;
+
+   // Edge flips that restored the Delauney condition after moving points.
+   std::size_t numFlips = 0;
+   // Moved points that left the polygon of their surrounding triangles and had
+   // to be removed and inserted again.
+   std::size_t numReinsertedPoints = 0;
+
+   // Number of times that the vertex and triangle buffers of the mesh had to
+   // grow. Each growth is a memory allocation. Reserving enough memory up front
+   // keeps these at zero.
+   std::size_t numVertexAllocations = 0;
+   std::size_t numTriangleAllocations = 0;
+};
+
+
+namespace internals
+{
+///////////////////
+
+// Adds the time between its construction and destruction to a given counter.
+// Does nothing when statistics are disabled.
+template <bool IsEnabled = DelauneyStatsEnabled> class ScopedStatsTimer
+{
+ public:
+   explicit ScopedStatsTimer(double& /*seconds*/) {}
+};
+
+
+template <> class ScopedStatsTimer<true>
+{
+ public:
+   explicit ScopedStatsTimer(double& seconds)
+   : m_seconds{seconds}, m_start{std::chrono::steady_clock::now()}
+   {
+   }
+   ~ScopedStatsTimer()
+   {
+      m_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                 m_start)
+                      .count();
+   }
+   ScopedStatsTimer(const ScopedStatsTimer&) = delete;
+   ScopedStatsTimer& operator=(const ScopedStatsTimer&) = delete;
+
+ private:
+   double& m_seconds;
+   std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace internals
+} // namespace geom
@@ -10,6 +10,7 @@
 #include "geom_util.h"
 #include "line_seg2_ct.h"
 #include "point2.h"
+#include "predicates.h"
 #include "rect.h"
 #include "triangle.h"
 #include <optional>
@@ -87,7 +88,8 @@ std::optional<std::size_t> DelauneyTriangle<T>::findVertex(const Point2<T>& pt)
 template <typename T>
 bool DelauneyTriangle<T>::isPointInCircumcircle(const Point2<T>& pt) const
 {
-   return sutil::lessEqual(distSquared(pt, m_circumcircle.center()), m_radiusSquared);
+   // Triangles store their vertices cw in the cartesian coordinate system.
+   return inCircle(m_triangle[0], m_triangle[2], m_triangle[1], pt) >= 0;
 }
 
 
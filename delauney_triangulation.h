@@ -7,110 +7,95 @@
 //
 #pragma once
 #include "circle.h"
+#include "delauney_divide_conquer.h"
+#include "delauney_mesh.h"
+#include "delauney_stats.h"
 #include "delauney_triangle.h"
+#include "delauney_validation.h"
 #include "geom_util.h"
-#include "line_seg2_ct.h"
+#include "indexed_triangulation.h"
 #include "point2.h"
+#include "predicates.h"
 #include "rect.h"
 #include "triangle.h"
 #include "essentutils/fputil.h"
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
-#include <set>
+#include <random>
+#include <utility>
 #include <vector>
 
 
 namespace geom
 {
-namespace internals
-{
 ///////////////////
 
-// Data structure to hold individual edges of triangles.
-template <typename T> class EdgeBuffer
+// Algorithms that can perform a Delauney triangulation.
+enum class DelauneyAlgorithm
 {
- public:
-   using const_iterator = typename std::vector<ct::LineSeg2<T>>::const_iterator;
-
- public:
-   void addEdges(const DelauneyTriangle<T>& t);
-   void clear() { m_edges.clear(); }
-   void removeDuplicates();
-   bool isDuplicateEdge(const ct::LineSeg2<T>& a, const ct::LineSeg2<T>& b) const;
-
-   std::size_t size() const { return m_edges.size(); }
-   const ct::LineSeg2<T>& operator[](std::size_t idx) const { return m_edges[idx]; }
-   const_iterator cbegin() const { return m_edges.cbegin(); }
-   const_iterator cend() const { return m_edges.cend(); }
-   const_iterator begin() const { return cbegin(); }
-   const_iterator end() const { return cend(); }
-
- private:
-   std::vector<ct::LineSeg2<T>> m_edges;
+   // Incremental insertion. Fast for typical inputs.
+   BowyerWatson,
+   // Guibas-Stolfi divide-and-conquer. O(n log n) for any input.
+   DivideAndConquer
 };
 
 
-template <typename T> void EdgeBuffer<T>::addEdges(const DelauneyTriangle<T>& t)
-{
-   for (int i = 0; i <= 2; ++i)
-      m_edges.push_back(t.edge(i));
-}
-
-
-template <typename T> void EdgeBuffer<T>::removeDuplicates()
+// Orders in which the Bowyer-Watson algorithm inserts points.
+enum class DelauneyInsertionOrder
 {
-   using IterSet = std::set<const_iterator>;
-
-   IterSet duplicates;
-   for (const_iterator i = begin(); i != end(); ++i)
-   {
-      for (const_iterator j = i + 1; j != end(); ++j)
-      {
-         if (isDuplicateEdge(*i, *j))
-         {
-            // Remove both duplicates!
-            duplicates.insert(i);
-            duplicates.insert(j);
-         }
-      }
-   }
-
-   std::for_each(duplicates.rbegin(), duplicates.rend(),
-                 [&](const_iterator iter) { m_edges.erase(iter); });
-}
-
-
-template <typename T>
-bool EdgeBuffer<T>::isDuplicateEdge(const ct::LineSeg2<T>& a,
-                                    const ct::LineSeg2<T>& b) const
-{
-   const auto sa = a.startPoint();
-   const auto ea = a.endPoint();
-   const auto sb = b.startPoint();
-   const auto eb = b.endPoint();
-   return (sa == sb && ea == eb) || (sa == eb && ea == sb);
-}
-
-} // namespace internals
+   // Points are sorted into vertical strips that are traversed in a snaking
+   // path. Fast for uniformly distributed points.
+   Strips,
+   // Biased randomized insertion order. Points are shuffled into rounds of
+   // doubling size and ordered along a Hilbert curve within each round. Robust
+   // for clustered and gridded points.
+   // Source:
+   // Amenta, Choi, Rote - Incremental constructions con BRIO, SoCG 2003
+   Brio
+};
 
 
 ///////////////////
 
-// Implementation of Bowyer-Watson algorithm to perform a Delauney triangulation
-// in 2D.
+// Delauney triangulation in 2D.
 // Triangulates a set of points so that each resulting triangle's cirumcircle
 // has an empty interior, i.e. does not contain any of the other points. This
 // is called the 'Delauney condition'.
+// By default the Bowyer-Watson algorithm is used. The triangulation is stored
+// in an index-based mesh that keeps track of neighboring triangles. New points
+// are located by walking through the mesh and the triangles that a new point
+// invalidates are found through their neighbors.
+// Alternatively, a divide-and-conquer algorithm can be selected. Both algorithms
+// produce triangles in the same format. The divide-and-conquer algorithm can
+// split the work across multiple threads. Its result does not depend on the
+// number of threads.
 // Source:
 // http://paulbourke.net/papers/triangulate/
 template <typename T> class DelauneyTriangulation
 {
  public:
    // Caller is responsible that sample points don't contain duplicates.
-   explicit DelauneyTriangulation(std::vector<Point2<T>> samples);
+   // PointWelder removes them and maps the original points to the remaining
+   // ones.
+   // The number of threads is only used by algorithms that support parallel
+   // execution. The insertion order is only used by the Bowyer-Watson
+   // algorithm.
+   explicit DelauneyTriangulation(
+      std::vector<Point2<T>> samples,
+      DelauneyAlgorithm algorithm = DelauneyAlgorithm::BowyerWatson,
+      std::size_t numThreads = 1,
+      DelauneyInsertionOrder insertionOrder = DelauneyInsertionOrder::Strips);
 
    // Starts the Delauney triangulation.
    std::vector<Triangle<T>> triangulate();
+   // Starts the Delauney triangulation and returns the result as vertex and
+   // index buffers. Each vertex is stored once. Optionally, includes the
+   // neighbors of each triangle. The result is not accessible through
+   // delauneyTriangles().
+   IndexedTriangulation<T> triangulateIndexed(bool withNeighbors = false);
 
    // Returns the triangulation extended with information that the algorithm
    // cached for each triangle, e.g. a triangle's circumcircle. Access is given
@@ -118,257 +103,194 @@ template <typename T> class DelauneyTriangulation
    // algorithm already calculated.
    std::vector<DelauneyTriangle<T>> delauneyTriangles() const;
 
+   // Returns statistics about the last triangulation. Only collected for the
+   // Bowyer-Watson algorithm and only when GEOM_DELAUNEY_STATS is defined.
+   const DelauneyStats& stats() const { return m_stats; }
+
    // Checks whether a given list of triangles satisfies the Delauney condition,
    // i.e. each triangle's cirumcircle has an empty interior (does not contain
-   // any of the other triangles corner points).
-   static bool isDelauneyConditionSatisfied(const std::vector<Triangle<T>>& triangles);
+   // any of the other triangles corner points). DelauneyValidator reports which
+   // triangles violate the condition.
+   static bool isDelauneyConditionSatisfied(const std::vector<Triangle<T>>& triangles,
+                                            std::size_t numThreads = 1);
 
- private:
-   template <typename T> using PointSet = std::set<Point2<T>, pointLess<T>>;
+   // Sorts given points so that consecutively inserted points are close to each
+   // other. This keeps the walks to locate them in the mesh short.
+   static void sortForInsertion(std::vector<Point2<T>>& points,
+                                DelauneyInsertionOrder order);
 
  private:
-   // Adds the edges of active triangles whose circumcircle contains a given sample
-   // point to a given edge buffer and removes the triangles from the given list.
-   void findEnclosingPolygonEdges(const Point2<T>& sample,
-                                  internals::EdgeBuffer<T>& edges);
-
-   // For each given edge generate a new triangle with a given sample point.
-   void generateNewTriangles(const Point2<T>& sample,
-                             const internals::EdgeBuffer<T>& edges);
-
-   // Mark all remaining triangles as settles.
-   void settleRemainingTriangles();
-
-   // Removes triangles from a given list that share vertices with a given master
-   // triangle.
-   void removeTrianglesSharingVertices(const Triangle<T>& master);
+   // Inserts all samples into the mesh. Returns false if there is nothing to
+   // triangulate.
+   bool runBowyerWatson();
 
-   // Calculates a triangle that encloses the given points. The points need to
-   // be completely inside the triangle, not just on its outline.
-   static Triangle<T> calcBoundingTriangle(const std::vector<Point2<T>>& points);
-
-   // Checks if a given  triangle needs to ever be considered again during the
-   // triangulation. Requires that the sample points of the triangulation
-   // are sorted by ascending x-coordinates.
-   static bool hasTriangleSettled(const DelauneyTriangle<T>& t, const Point2<T>& pt);
-
-   // Returns a list of plain triangles from a given list of Delauney triangles.
-   static std::vector<Triangle<T>>
-   prepareResult(const std::vector<DelauneyTriangle<T>>& delauneyTriangles);
-
-   // Returns a set of all unique vertices of a given list of triangles.
-   static PointSet<T> collectPoints(const std::vector<Triangle<T>>& triangles);
+   static void sortInStrips(std::vector<Point2<T>>& points);
+   static void sortBiasedRandomized(std::vector<Point2<T>>& points);
 
  private:
    // List of points that define the triangulation.
    std::vector<Point2<T>> m_samples;
-   // Triangle that bounds all input points.
-   Triangle<T> m_boundingTriangle;
-   // Current state of the triangulation. Holds active triangles and some data
-   // that they are annotated with.
-   std::vector<DelauneyTriangle<T>> m_triangulation;
-   // List of triangles that don't need to be considered anymore for further
-   // triangulation steps.
-   std::vector<DelauneyTriangle<T>> m_settledTriangles;
+   DelauneyAlgorithm m_algorithm = DelauneyAlgorithm::BowyerWatson;
+   std::size_t m_numThreads = 1;
+   // Current state of the triangulation.
+   internals::DelauneyMesh<T> m_mesh;
+   // Resulting triangles.
+   std::vector<Triangle<T>> m_triangles;
+   DelauneyStats m_stats;
+   // Time spent sorting the samples into insertion order.
+   double m_sortSeconds = 0.0;
 };
 
 
 template <typename T>
-DelauneyTriangulation<T>::DelauneyTriangulation(std::vector<Point2<T>> samples)
-: m_samples{std::move(samples)}, m_boundingTriangle{calcBoundingTriangle(m_samples)}
+DelauneyTriangulation<T>::DelauneyTriangulation(std::vector<Point2<T>> samples,
+                                                DelauneyAlgorithm algorithm,
+                                                std::size_t numThreads,
+                                                DelauneyInsertionOrder insertionOrder)
+: m_samples{std::move(samples)}, m_algorithm{algorithm}, m_numThreads{numThreads}
 {
-   // Add bounding triangle vertices to the end of the vertex list.
-   if (!m_boundingTriangle.isDegenerate())
+   if (m_algorithm == DelauneyAlgorithm::BowyerWatson)
    {
-      m_samples.push_back(m_boundingTriangle[0]);
-      m_samples.push_back(m_boundingTriangle[1]);
-      m_samples.push_back(m_boundingTriangle[2]);
+      internals::ScopedStatsTimer<> timer{m_sortSeconds};
+      sortForInsertion(m_samples, insertionOrder);
    }
-
-   // Sort all collected sample points by their x-coordinate to enable
-   // detecting triangles that cannot affect the triangulation anymore.
-   std::sort(m_samples.begin(), m_samples.end(), pointLess<T>());
 }
 
 
 template <typename T> std::vector<Triangle<T>> DelauneyTriangulation<T>::triangulate()
 {
-   if (m_boundingTriangle.isDegenerate())
-      return {};
-
-   m_triangulation.push_back(m_boundingTriangle);
-   internals::EdgeBuffer<T> edges;
-
-   for (const Point2<T>& sample : m_samples)
+   if (m_algorithm == DelauneyAlgorithm::DivideAndConquer)
    {
-      edges.clear();
-      findEnclosingPolygonEdges(sample, edges);
-      edges.removeDuplicates();
-      generateNewTriangles(sample, edges);
+      m_triangles =
+         internals::DelauneyDivideConquer<T>::triangulate(m_samples, m_numThreads);
+      return m_triangles;
    }
 
-   settleRemainingTriangles();
-   removeTrianglesSharingVertices(m_boundingTriangle);
-
-   return prepareResult(m_settledTriangles);
+   m_triangles.clear();
+   if (runBowyerWatson())
+   {
+      internals::ScopedStatsTimer<> timer{m_stats.outputSeconds};
+      m_mesh.triangles(m_triangles);
+   }
+   return m_triangles;
 }
 
 
 template <typename T>
-std::vector<DelauneyTriangle<T>> DelauneyTriangulation<T>::delauneyTriangles() const
+IndexedTriangulation<T> DelauneyTriangulation<T>::triangulateIndexed(bool withNeighbors)
 {
-   return m_settledTriangles;
+   if (m_algorithm == DelauneyAlgorithm::DivideAndConquer)
+      return internals::DelauneyDivideConquer<T>::triangulateIndexed(
+         m_samples, m_numThreads, withNeighbors);
+
+   if (!runBowyerWatson())
+      return {};
+   internals::ScopedStatsTimer<> timer{m_stats.outputSeconds};
+   return m_mesh.indexedTriangles(withNeighbors);
 }
 
 
-template <typename T>
-bool DelauneyTriangulation<T>::isDelauneyConditionSatisfied(
-   const std::vector<Triangle<T>>& triangles)
+template <typename T> bool DelauneyTriangulation<T>::runBowyerWatson()
 {
-   PointSet<T> vertices = collectPoints(triangles);
-   for (const auto& t : triangles)
+   m_mesh.init(m_samples.size());
+   for (const Point2<T>& sample : m_samples)
+      m_mesh.insert(sample);
+   if constexpr (DelauneyStatsEnabled)
    {
-      const auto ccircle = t.calcCircumcircle();
-      if (ccircle)
-      {
-         for (const auto& pt : vertices)
-            if (isPointInsideCircle(*ccircle, pt))
-               return false;
-      }
+      m_stats = m_mesh.stats();
+      m_stats.sortSeconds = m_sortSeconds;
    }
-
-   return true;
+   // Without triangles the samples are collinear or too few.
+   return m_mesh.hasTriangles();
 }
 
 
 template <typename T>
-void DelauneyTriangulation<T>::findEnclosingPolygonEdges(const Point2<T>& sample,
-                                                         internals::EdgeBuffer<T>& edges)
+std::vector<DelauneyTriangle<T>> DelauneyTriangulation<T>::delauneyTriangles() const
 {
-   std::size_t i = 0;
-   while (i < m_triangulation.size())
-   {
-      const DelauneyTriangle<T>& t = m_triangulation[i];
-      if (hasTriangleSettled(t, sample))
-      {
-         m_settledTriangles.push_back(t);
-         m_triangulation.erase(m_triangulation.begin() + i);
-         continue;
-      }
-
-      if (t.isPointInCircumcircle(sample))
-      {
-         edges.addEdges(t);
-         m_triangulation.erase(m_triangulation.begin() + i);
-         // Since we removed the triangle we don't need to increase
-         // the loop counter.
-      }
-      else
-      {
-         ++i;
-      }
-   }
+   return std::vector<DelauneyTriangle<T>>(m_triangles.begin(), m_triangles.end());
 }
 
 
 template <typename T>
-void DelauneyTriangulation<T>::generateNewTriangles(const Point2<T>& sample,
-                                                    const internals::EdgeBuffer<T>& edges)
+bool DelauneyTriangulation<T>::isDelauneyConditionSatisfied(
+   const std::vector<Triangle<T>>& triangles, std::size_t numThreads)
 {
-   for (const ct::LineSeg2<T>& e : edges)
-   {
-      const auto startPt = e.startPoint();
-      const auto endPt = e.endPoint();
-      if (!startPt || !endPt)
-         continue;
-
-      const Triangle<T> t(sample, *startPt, *endPt);
-      // Skip triangles that are lines or points.
-      if (!t.isDegenerate())
-         m_triangulation.push_back(t);
-   }
+   return DelauneyValidator<T>::findViolations(triangles, numThreads).empty();
 }
 
 
-template <typename T> void DelauneyTriangulation<T>::settleRemainingTriangles()
+template <typename T>
+void DelauneyTriangulation<T>::sortForInsertion(std::vector<Point2<T>>& points,
+                                                DelauneyInsertionOrder order)
 {
-   std::move(m_triangulation.begin(), m_triangulation.end(),
-             std::back_inserter(m_settledTriangles));
-   m_triangulation.clear();
+   if (order == DelauneyInsertionOrder::Brio)
+      sortBiasedRandomized(points);
+   else
+      sortInStrips(points);
 }
 
 
 template <typename T>
-void DelauneyTriangulation<T>::removeTrianglesSharingVertices(const Triangle<T>& master)
+void DelauneyTriangulation<T>::sortInStrips(std::vector<Point2<T>>& points)
 {
-   std::size_t i = 0;
-   while (i < m_settledTriangles.size())
+   // Sort the points by their x-coordinate and cut them into vertical strips of
+   // about sqrt(n) points each. Sorting the strips by y-coordinate in alternating
+   // directions results in a path that snakes through the points.
+   std::sort(points.begin(), points.end(), pointLess<T>());
+
+   const std::size_t stripSize = static_cast<std::size_t>(
+      std::ceil(std::sqrt(static_cast<double>(points.size()))));
+   bool isAscending = true;
+   for (std::size_t first = 0; first < points.size(); first += stripSize)
    {
-      const DelauneyTriangle<T>& t = m_settledTriangles[i];
-
-      bool wasRemoved = false;
-      for (std::size_t j = 0; j < 3; ++j)
-      {
-         if (master.hasVertex(t[j]))
-         {
-            m_settledTriangles.erase(m_settledTriangles.begin() + i);
-            wasRemoved = true;
-            break;
-         }
-      }
-
-      if (!wasRemoved)
-         ++i;
+      const auto stripBegin = points.begin() + first;
+      const auto stripEnd = points.begin() + std::min(first + stripSize, points.size());
+      std::sort(stripBegin, stripEnd, [isAscending](const auto& a, const auto& b) {
+         return isAscending ? a.y() < b.y() : a.y() > b.y();
+      });
+      isAscending = !isAscending;
    }
 }
 
 
 template <typename T>
-Triangle<T>
-DelauneyTriangulation<T>::calcBoundingTriangle(const std::vector<Point2<T>>& points)
+void DelauneyTriangulation<T>::sortBiasedRandomized(std::vector<Point2<T>>& points)
 {
    const auto bounds = calcPathBounds<T>(points.begin(), points.end());
-   if (!bounds || bounds->isDegenerate())
-      return Triangle<T>{};
-
-   const T dimMax = std::max(bounds->width(), bounds->height());
-   const Point2<T> center = bounds->center();
-   constexpr T Scale = 20;
-
-   const Point2<T> a{center.x() - Scale * dimMax, center.y() - dimMax};
-   const Point2<T> b{center.x(), center.y() + Scale * dimMax};
-   const Point2<T> c{center.x() + Scale * dimMax, center.y() - dimMax};
-   return Triangle{a, b, c};
-}
-
-
-template <typename T>
-bool DelauneyTriangulation<T>::hasTriangleSettled(const DelauneyTriangle<T>& t,
-                                                  const Point2<T>& pt)
-{
-   return sutil::greater(pt.x() - t.circumcenter().x(), t.circumcircleRadius());
-}
-
-
-template <typename T>
-std::vector<Triangle<T>> DelauneyTriangulation<T>::prepareResult(
-   const std::vector<DelauneyTriangle<T>>& delauneyTriangles)
-{
-   std::vector<Triangle<T>> result(delauneyTriangles.size());
-   std::transform(delauneyTriangles.begin(), delauneyTriangles.end(), result.begin(),
-                  [](const auto& dt) { return dt.triangle(); });
-   return result;
-}
-
+   if (!bounds)
+      return;
+
+   // Use a fixed seed to make the triangulation reproducible.
+   std::mt19937 gen{12345};
+   std::shuffle(points.begin(), points.end(), gen);
+
+   // Split the points into rounds that double in size. The last round gets half
+   // of the points, the round before a quarter, and so on. Rounds below a
+   // minimal size are combined into the first round.
+   constexpr std::size_t MinRoundSize = 64;
+   std::vector<std::size_t> roundStarts;
+   for (std::size_t start = points.size() / 2; start >= MinRoundSize; start /= 2)
+      roundStarts.push_back(start);
+   roundStarts.push_back(0);
+
+   // Order each round along a Hilbert curve. Precalculate the curve index of
+   // each point to not recalculate it for each comparison.
+   std::vector<std::pair<std::uint64_t, Point2<T>>> indexed;
+   indexed.reserve(points.size());
+   for (const Point2<T>& pt : points)
+      indexed.emplace_back(hilbertIndex(pt, *bounds), pt);
+
+   std::size_t roundEnd = points.size();
+   for (const std::size_t roundStart : roundStarts)
+   {
+      std::sort(indexed.begin() + roundStart, indexed.begin() + roundEnd,
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+      roundEnd = roundStart;
+   }
 
-template <typename T>
-DelauneyTriangulation<T>::PointSet<T>
-DelauneyTriangulation<T>::collectPoints(const std::vector<Triangle<T>>& triangles)
-{
-   PointSet<T> vertices;
-   for (const auto& t : triangles)
-      std::copy(t.begin(), t.end(), std::inserter(vertices, vertices.begin()));
-   return vertices;
+   for (std::size_t i = 0; i < points.size(); ++i)
+      points[i] = indexed[i].second;
 }
 
 } // namespace geom
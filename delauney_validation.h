@@ -0,0 +1,312 @@
+//
+// geomcpp
+// Validation of Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_circumcircles.h"
+#include "geom_util.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include "triangle.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Checks triangulations for the Delauney condition, i.e. that no triangle's
+// circumcircle contains a vertex of the triangulation in its interior.
+// Each triangle is only tested against the vertices near its circumcircle:
+// - The vertices are sorted into a uniform grid with about two vertices per
+//   cell.
+// - Only the cells that overlap the bounding box of a circumcircle are
+//   visited. For evenly distributed points this takes O(n) time overall. The
+//   large circumcircles of sliver triangles along the hull cover more cells.
+// - Vertices that are too close to a circle to decide from the rounded circle
+//   are tested with the exact in-circle predicate.
+// The triangles can be split across multiple threads. The result does not
+// depend on the number of threads.
+template <typename T> class DelauneyValidator
+{
+ public:
+   // Returns the indices of the triangles whose circumcircle contains a vertex
+   // of the triangulation in ascending order. Degenerate triangles are skipped.
+   static std::vector<std::size_t> findViolations(const std::vector<Triangle<T>>& triangles,
+                                                  std::size_t numThreads = 1);
+   static std::vector<std::size_t>
+   findViolations(const IndexedTriangulation<T>& triangulation, std::size_t numThreads = 1);
+
+ private:
+   // Vertices of a triangle in ccw order (cartesian coordinate system).
+   using CcwTriangle = std::array<Point2<T>, 3>;
+
+   // Minimal number of triangles that are worth running on a separate thread.
+   static constexpr std::size_t MinParallelTriangles = 10000;
+
+   // Prepares testing the given triangles against the given vertices. The
+   // vertices have to be free of duplicates.
+   DelauneyValidator(const std::vector<Point2<T>>& vertices,
+                     std::vector<CcwTriangle> triangles);
+
+   std::vector<std::size_t> run(std::size_t numThreads) const;
+   // Collects the violating triangles in the range [first, last).
+   void findViolations(std::size_t first, std::size_t last,
+                       std::vector<std::size_t>& result) const;
+   // Checks if the circumcircle of the triangle at a given index contains a
+   // vertex.
+   bool isViolated(std::size_t idx) const;
+
+   // Sorts the vertices into the cells of the grid.
+   void buildGrid(const std::vector<Point2<T>>& vertices);
+   // Returns the cell index along one axis for a given coordinate. Coordinates
+   // outside of the grid are clamped to the outermost cells.
+   static std::size_t cellPos(T coord, T gridMin, T invCellSize, std::size_t numCells);
+
+ private:
+   std::vector<CcwTriangle> m_triangles;
+   internals::CircumcircleCache<T> m_circles;
+
+   // Grid of vertices. The vertices of a cell are stored consecutively. The
+   // vertices of cell i are in the range [m_cellStart[i], m_cellStart[i+1]).
+   T m_gridLeft = T(0);
+   T m_gridTop = T(0);
+   T m_invCellWidth = T(0);
+   T m_invCellHeight = T(0);
+   std::size_t m_numCellsX = 1;
+   std::size_t m_numCellsY = 1;
+   std::vector<std::size_t> m_cellStart;
+   std::vector<Point2<T>> m_cellVertices;
+};
+
+
+template <typename T>
+std::vector<std::size_t>
+DelauneyValidator<T>::findViolations(const std::vector<Triangle<T>>& triangles,
+                                     std::size_t numThreads)
+{
+   std::vector<Point2<T>> vertices;
+   vertices.reserve(3 * triangles.size());
+   std::vector<CcwTriangle> ccwTriangles;
+   ccwTriangles.reserve(triangles.size());
+   for (const auto& t : triangles)
+   {
+      vertices.insert(vertices.end(), {t[0], t[1], t[2]});
+      // Triangles store their vertices cw in the cartesian coordinate system.
+      ccwTriangles.push_back({t[0], t[2], t[1]});
+   }
+
+   // Triangles share their vertices.
+   std::sort(vertices.begin(), vertices.end(), pointLess<T>());
+   vertices.erase(std::unique(vertices.begin(), vertices.end(),
+                              [](const Point2<T>& a, const Point2<T>& b) {
+                                 return a.x() == b.x() && a.y() == b.y();
+                              }),
+                  vertices.end());
+
+   return DelauneyValidator{vertices, std::move(ccwTriangles)}.run(numThreads);
+}
+
+
+template <typename T>
+std::vector<std::size_t>
+DelauneyValidator<T>::findViolations(const IndexedTriangulation<T>& triangulation,
+                                     std::size_t numThreads)
+{
+   const std::vector<Point2<T>>& vertices = triangulation.vertices;
+   const std::vector<std::uint32_t>& indices = triangulation.indices;
+
+   std::vector<CcwTriangle> ccwTriangles;
+   ccwTriangles.reserve(triangulation.numTriangles());
+   for (std::size_t i = 0; i < indices.size(); i += 3)
+      ccwTriangles.push_back(
+         {vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]]});
+
+   return DelauneyValidator{vertices, std::move(ccwTriangles)}.run(numThreads);
+}
+
+
+template <typename T>
+DelauneyValidator<T>::DelauneyValidator(const std::vector<Point2<T>>& vertices,
+                                        std::vector<CcwTriangle> triangles)
+: m_triangles{std::move(triangles)}
+{
+   m_circles.reserve(m_triangles.size());
+   for (const CcwTriangle& t : m_triangles)
+      m_circles.add(t[0], t[1], t[2]);
+
+   buildGrid(vertices);
+}
+
+
+template <typename T>
+std::vector<std::size_t> DelauneyValidator<T>::run(std::size_t numThreads) const
+{
+   const std::size_t numTriangles = m_triangles.size();
+   numThreads = std::clamp<std::size_t>(numTriangles / MinParallelTriangles, 1,
+                                        std::max<std::size_t>(numThreads, 1));
+
+   // Each thread collects the violations of a consecutive range of triangles.
+   // Concatenating the ranges in order keeps the result sorted.
+   std::vector<std::vector<std::size_t>> results(numThreads);
+   std::vector<std::future<void>> threads;
+   for (std::size_t i = 1; i < numThreads; ++i)
+   {
+      threads.push_back(std::async(std::launch::async, [this, &results, i, numThreads,
+                                                        numTriangles]() {
+         findViolations(i * numTriangles / numThreads,
+                        (i + 1) * numTriangles / numThreads, results[i]);
+      }));
+   }
+   findViolations(0, numTriangles / numThreads, results[0]);
+   for (auto& thread : threads)
+      thread.get();
+
+   std::vector<std::size_t> violations = std::move(results[0]);
+   for (std::size_t i = 1; i < numThreads; ++i)
+      violations.insert(violations.end(), results[i].begin(), results[i].end());
+   return violations;
+}
+
+
+template <typename T>
+void DelauneyValidator<T>::findViolations(std::size_t first, std::size_t last,
+                                          std::vector<std::size_t>& result) const
+{
+   for (std::size_t i = first; i < last; ++i)
+      if (isViolated(i))
+         result.push_back(i);
+}
+
+
+template <typename T> bool DelauneyValidator<T>::isViolated(std::size_t idx) const
+{
+   const CcwTriangle& t = m_triangles[idx];
+   if (orient2d(t[0], t[1], t[2]) == 0)
+      return false;
+
+   // Visit the cells that overlap the bounding box of the circle.
+   const Point2<T> center = m_circles.center(idx);
+   const T radius = m_circles.outerRadius(idx);
+   const std::size_t left =
+      cellPos(center.x() - radius, m_gridLeft, m_invCellWidth, m_numCellsX);
+   const std::size_t right =
+      cellPos(center.x() + radius, m_gridLeft, m_invCellWidth, m_numCellsX);
+   const std::size_t top =
+      cellPos(center.y() - radius, m_gridTop, m_invCellHeight, m_numCellsY);
+   const std::size_t bottom =
+      cellPos(center.y() + radius, m_gridTop, m_invCellHeight, m_numCellsY);
+
+   const auto isTriangleVertex = [&t](const Point2<T>& pt) {
+      for (const Point2<T>& v : t)
+         if (v.x() == pt.x() && v.y() == pt.y())
+            return true;
+      return false;
+   };
+
+   for (std::size_t y = top; y <= bottom; ++y)
+   {
+      // The cells of a grid row are stored consecutively.
+      const std::size_t rowStart = y * m_numCellsX;
+      const std::size_t end = m_cellStart[rowStart + right + 1];
+      for (std::size_t i = m_cellStart[rowStart + left]; i < end; ++i)
+      {
+         const Point2<T>& pt = m_cellVertices[i];
+         const internals::CircleSide side = m_circles.side(idx, pt);
+         if (side == internals::CircleSide::Outside)
+            continue;
+         // The exact predicate decides points that are too close to the circle.
+         // The triangle's own vertices are on the circle.
+         if (side == internals::CircleSide::Inside ||
+             (!isTriangleVertex(pt) && inCircle(t[0], t[1], t[2], pt) > 0))
+         {
+            return true;
+         }
+      }
+   }
+
+   return false;
+}
+
+
+template <typename T>
+void DelauneyValidator<T>::buildGrid(const std::vector<Point2<T>>& vertices)
+{
+   const auto bounds = calcPathBounds<T>(vertices.begin(), vertices.end());
+   if (!bounds)
+   {
+      m_cellStart.assign(2, 0);
+      return;
+   }
+
+   // Choose the number of cells along each axis so that the cells are about
+   // square and hold about two vertices each.
+   const T width = bounds->width();
+   const T height = bounds->height();
+   const double numCells = std::max(static_cast<double>(vertices.size()) / 2.0, 1.0);
+   if (width > T(0) && height > T(0))
+   {
+      const double aspect = static_cast<double>(width) / static_cast<double>(height);
+      m_numCellsX = static_cast<std::size_t>(std::ceil(std::sqrt(numCells * aspect)));
+      m_numCellsY = static_cast<std::size_t>(std::ceil(numCells / m_numCellsX));
+   }
+   else if (width > T(0))
+   {
+      m_numCellsX = static_cast<std::size_t>(numCells);
+   }
+   else if (height > T(0))
+   {
+      m_numCellsY = static_cast<std::size_t>(numCells);
+   }
+   m_numCellsX = std::max<std::size_t>(m_numCellsX, 1);
+   m_numCellsY = std::max<std::size_t>(m_numCellsY, 1);
+
+   m_gridLeft = bounds->left();
+   m_gridTop = bounds->top();
+   m_invCellWidth = width > T(0) ? static_cast<T>(m_numCellsX) / width : T(0);
+   m_invCellHeight = height > T(0) ? static_cast<T>(m_numCellsY) / height : T(0);
+
+   // Counting sort of the vertices by cell.
+   std::vector<std::size_t> cellOfVertex(vertices.size());
+   m_cellStart.assign(m_numCellsX * m_numCellsY + 1, 0);
+   for (std::size_t i = 0; i < vertices.size(); ++i)
+   {
+      const Point2<T>& pt = vertices[i];
+      cellOfVertex[i] =
+         cellPos(pt.y(), m_gridTop, m_invCellHeight, m_numCellsY) * m_numCellsX +
+         cellPos(pt.x(), m_gridLeft, m_invCellWidth, m_numCellsX);
+      ++m_cellStart[cellOfVertex[i] + 1];
+   }
+   for (std::size_t i = 1; i < m_cellStart.size(); ++i)
+      m_cellStart[i] += m_cellStart[i - 1];
+
+   std::vector<std::size_t> next(m_cellStart.begin(), m_cellStart.end() - 1);
+   m_cellVertices.resize(vertices.size());
+   for (std::size_t i = 0; i < vertices.size(); ++i)
+      m_cellVertices[next[cellOfVertex[i]]++] = vertices[i];
+}
+
+
+template <typename T>
+std::size_t DelauneyValidator<T>::cellPos(T coord, T gridMin, T invCellSize,
+                                          std::size_t numCells)
+{
+   const T pos = std::floor((coord - gridMin) * invCellSize);
+   if (!(pos > T(0)))
+      return 0;
+   if (pos >= static_cast<T>(numCells - 1))
+      return numCells - 1;
+   return static_cast<std::size_t>(pos);
+}
+
+} // namespace geom
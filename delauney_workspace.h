@@ -0,0 +1,117 @@
+//
+// geomcpp
+// Reusable workspace for Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_mesh.h"
+#include "delauney_stats.h"
+#include "delauney_triangulation.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "triangle.h"
+#include <cstddef>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Triangulates point sets one after the other with the Bowyer-Watson algorithm.
+// All buffers keep their memory between calls. Once the buffers have grown to
+// the size of the largest point set, further calls don't allocate memory. This
+// makes the workspace suitable for triangulating many small point sets, e.g.
+// local meshes for each frame.
+// The points are inserted in strip order. The results reference the buffers of
+// the workspace and stay valid until the next call.
+template <typename T> class DelauneyWorkspace
+{
+ public:
+   // Reserves memory for triangulating a given number of points.
+   void reserve(std::size_t numPoints);
+
+   // Triangulates the points in a given range. Exact duplicates are ignored.
+   template <typename PointIter>
+   const std::vector<Triangle<T>>& triangulate(PointIter first, PointIter last);
+   const std::vector<Triangle<T>>& triangulate(const std::vector<Point2<T>>& points)
+   {
+      return triangulate(points.begin(), points.end());
+   }
+
+   // Triangulates the points in a given range and returns the result as vertex
+   // and index buffers. Optionally, includes the neighbors of each triangle.
+   template <typename PointIter>
+   const IndexedTriangulation<T>& triangulateIndexed(PointIter first, PointIter last,
+                                                     bool withNeighbors = false);
+   const IndexedTriangulation<T>&
+   triangulateIndexed(const std::vector<Point2<T>>& points, bool withNeighbors = false)
+   {
+      return triangulateIndexed(points.begin(), points.end(), withNeighbors);
+   }
+
+   // Returns statistics about the last triangulation. Only collected when
+   // GEOM_DELAUNEY_STATS is defined. The sorting and output phases are not timed.
+   const DelauneyStats& stats() const { return m_mesh.stats(); }
+
+ private:
+   // Inserts the points in the given range into the mesh.
+   template <typename PointIter> void run(PointIter first, PointIter last);
+
+ private:
+   std::vector<Point2<T>> m_samples;
+   internals::DelauneyMesh<T> m_mesh;
+   std::vector<Triangle<T>> m_triangles;
+   IndexedTriangulation<T> m_indexed;
+};
+
+
+template <typename T> void DelauneyWorkspace<T>::reserve(std::size_t numPoints)
+{
+   m_samples.reserve(numPoints);
+   m_mesh.init(numPoints);
+   m_triangles.reserve(2 * numPoints);
+   m_indexed.vertices.reserve(numPoints);
+   m_indexed.indices.reserve(6 * numPoints);
+   m_indexed.neighbors.reserve(6 * numPoints);
+}
+
+
+template <typename T>
+template <typename PointIter>
+const std::vector<Triangle<T>>& DelauneyWorkspace<T>::triangulate(PointIter first,
+                                                                  PointIter last)
+{
+   run(first, last);
+   m_mesh.triangles(m_triangles);
+   return m_triangles;
+}
+
+
+template <typename T>
+template <typename PointIter>
+const IndexedTriangulation<T>&
+DelauneyWorkspace<T>::triangulateIndexed(PointIter first, PointIter last,
+                                         bool withNeighbors)
+{
+   run(first, last);
+   m_mesh.indexedTriangles(withNeighbors, m_indexed);
+   return m_indexed;
+}
+
+
+template <typename T>
+template <typename PointIter>
+void DelauneyWorkspace<T>::run(PointIter first, PointIter last)
+{
+   m_samples.assign(first, last);
+   DelauneyTriangulation<T>::sortForInsertion(m_samples, DelauneyInsertionOrder::Strips);
+
+   m_mesh.init(m_samples.size());
+   for (const Point2<T>& sample : m_samples)
+      m_mesh.insert(sample);
+}
+
+} // namespace geom
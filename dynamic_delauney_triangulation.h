@@ -0,0 +1,91 @@
+//
+// geomcpp
+// Delauney triangulation with incremental updates.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_mesh.h"
+#include "point2.h"
+#include "rect.h"
+#include "triangle.h"
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Delauney triangulation of a changing set of points.
+// Points can be inserted and removed at any time. Each update only changes the
+// triangles around the updated point:
+// - An inserted point replaces the triangles whose circumcircle contains it.
+// - A removed point leaves a hole that is filled with new triangles.
+// Optionally, the points can be restricted to bounds that are given upfront.
+template <typename T> class DynamicDelauneyTriangulation
+{
+ public:
+   DynamicDelauneyTriangulation();
+   // The bounds cannot be degenerate.
+   explicit DynamicDelauneyTriangulation(const Rect<T>& bounds);
+
+   // Inserts a point. Returns false if the point is outside the bounds or is
+   // already part of the triangulation.
+   bool insert(const Point2<T>& pt);
+   // Removes a point. Returns false if the point is not part of the
+   // triangulation.
+   bool remove(const Point2<T>& pt);
+
+   // Returns the number of points in the triangulation.
+   std::size_t size() const { return m_numPoints; }
+   // Returns the current triangulation.
+   std::vector<Triangle<T>> triangles() const { return m_mesh.triangles(); }
+
+ private:
+   std::optional<Rect<T>> m_bounds;
+   internals::DelauneyMesh<T> m_mesh;
+   std::size_t m_numPoints = 0;
+};
+
+
+template <typename T> DynamicDelauneyTriangulation<T>::DynamicDelauneyTriangulation()
+{
+   m_mesh.init(0);
+}
+
+
+template <typename T>
+DynamicDelauneyTriangulation<T>::DynamicDelauneyTriangulation(const Rect<T>& bounds)
+: m_bounds{bounds}
+{
+   assert(!m_bounds->isDegenerate());
+   m_mesh.init(0);
+}
+
+
+template <typename T> bool DynamicDelauneyTriangulation<T>::insert(const Point2<T>& pt)
+{
+   if (m_bounds && !m_bounds->isPointInRect(pt))
+      return false;
+   if (m_mesh.insert(pt) == internals::DelauneyMesh<T>::NoIdx)
+      return false;
+
+   ++m_numPoints;
+   return true;
+}
+
+
+template <typename T> bool DynamicDelauneyTriangulation<T>::remove(const Point2<T>& pt)
+{
+   if (!m_mesh.remove(pt))
+      return false;
+
+   --m_numPoints;
+   return true;
+}
+
+} // namespace geom
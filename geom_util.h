@@ -9,8 +9,11 @@
 #include "geom_types.h"
 #include "rect.h"
 #include "vec2.h"
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <optional>
+#include <utility>
 
 
 namespace geom
@@ -87,4 +90,49 @@ template <typename PointIter> bool isConvexPath(PointIter first, PointIter last)
    return true;
 }
 
+
+// Calculates the index of a point along a Hilbert curve that fills given
+// bounds. The bounds are divided into a grid of 2^order by 2^order cells. Points
+// in the same cell have the same index. Points that are close along the curve
+// are close in space.
+template <typename T>
+std::uint64_t hilbertIndex(const Point2<T>& pt, const Rect<T>& bounds,
+                           unsigned int order = 16)
+{
+   const std::uint32_t numCells = std::uint32_t(1) << order;
+
+   // Maps a coordinate to its cell.
+   const auto toCell = [numCells](T coord, T min, T extent) {
+      if (extent <= 0)
+         return std::uint32_t(0);
+      const double normed = (static_cast<double>(coord) - static_cast<double>(min)) /
+                            static_cast<double>(extent);
+      const double cell = std::clamp(normed * numCells, 0.0, numCells - 1.0);
+      return static_cast<std::uint32_t>(cell);
+   };
+   std::uint32_t x = toCell(pt.x(), bounds.left(), bounds.width());
+   std::uint32_t y = toCell(pt.y(), bounds.top(), bounds.height());
+
+   std::uint64_t idx = 0;
+   for (std::uint32_t s = numCells / 2; s > 0; s /= 2)
+   {
+      const std::uint32_t rx = (x & s) > 0 ? 1 : 0;
+      const std::uint32_t ry = (y & s) > 0 ? 1 : 0;
+      idx += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+
+      // Rotate the quadrant so that the curve within it has the base orientation.
+      if (ry == 0)
+      {
+         if (rx == 1)
+         {
+            x = numCells - 1 - x;
+            y = numCells - 1 - y;
+         }
+         std::swap(x, y);
+      }
+   }
+
+   return idx;
+}
+
 } // namespace geom
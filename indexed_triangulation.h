@@ -0,0 +1,53 @@
+//
+// geomcpp
+// Triangulation stored as vertex and index buffers.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include "triangle.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Triangulation that stores each vertex once and references vertices and
+// triangles by 32-bit indices. Compact alternative to a list of triangles that
+// repeats each shared vertex for every triangle it belongs to.
+template <typename T> struct IndexedTriangulation
+{
+   // Marks a triangle edge without a neighbor triangle, i.e. an edge on the
+   // outline of the triangulation.
+   static constexpr std::uint32_t NoNeighbor = std::numeric_limits<std::uint32_t>::max();
+
+   std::size_t numTriangles() const { return indices.size() / 3; }
+   // Returns the triangle at a given index.
+   Triangle<T> triangle(std::size_t idx) const;
+   bool hasNeighbors() const { return !neighbors.empty(); }
+
+   // Vertices that are referenced by the triangles.
+   std::vector<Point2<T>> vertices;
+   // Three vertex indices for each triangle in ccw order (cartesian coordinate
+   // system).
+   std::vector<std::uint32_t> indices;
+   // Optional. Three neighbor triangle indices for each triangle. The neighbor at
+   // position i is across the edge opposite of the triangle's vertex i, i.e.
+   // the edge from vertex i+1 to i+2. Empty if neighbors were not requested.
+   std::vector<std::uint32_t> neighbors;
+};
+
+
+template <typename T> Triangle<T> IndexedTriangulation<T>::triangle(std::size_t idx) const
+{
+   return Triangle<T>{vertices[indices[3 * idx]], vertices[indices[3 * idx + 1]],
+                      vertices[indices[3 * idx + 2]]};
+}
+
+} // namespace geom
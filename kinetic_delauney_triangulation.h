@@ -0,0 +1,153 @@
+//
+// geomcpp
+// Delauney triangulation of moving points.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_mesh.h"
+#include "delauney_stats.h"
+#include "geom_util.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "triangle.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Delauney triangulation of a fixed set of points that move over time, e.g.
+// the sites of a simulation. Instead of triangulating the points again after
+// each step, the existing triangulation is repaired:
+// - All points are moved at once. As long as the triangles stay valid, i.e.
+//   ccw with a convex hull, only edges that violate the Delauney condition
+//   afterwards get flipped.
+// - Points whose triangles become invalid are moved one by one. Points that
+//   leave the polygon of their surrounding triangles are removed and inserted
+//   again.
+// For small movements this is much cheaper than a new triangulation.
+// The points are identified by their index in the initial list of points.
+template <typename T> class KineticDelauneyTriangulation
+{
+ public:
+   // Points that coincide exactly with a previous point are not part of the
+   // triangulation until they move to a free position.
+   explicit KineticDelauneyTriangulation(const std::vector<Point2<T>>& points);
+
+   // Moves the points to new positions. The position at index i is the new
+   // position of point i. Points that would coincide exactly with another point
+   // keep their previous position. Returns the number of such points.
+   std::size_t update(const std::vector<Point2<T>>& positions);
+
+   // Returns the number of points.
+   std::size_t size() const { return m_positions.size(); }
+   // Returns the position of the point at a given index.
+   const Point2<T>& position(std::size_t idx) const
+   {
+      const VertexIdx vertex = m_vertexOfPoint[idx];
+      return vertex != NoIdx ? m_mesh.vertex(vertex) : m_positions[idx];
+   }
+   // Returns the current triangulation.
+   std::vector<Triangle<T>> triangles() const { return m_mesh.triangles(); }
+   // Returns the current triangulation as vertex and index buffers. Optionally,
+   // includes the neighbors of each triangle.
+   IndexedTriangulation<T> indexedTriangles(bool withNeighbors = false)
+   {
+      return m_mesh.indexedTriangles(withNeighbors);
+   }
+   // Returns statistics about all updates. Only collected when
+   // GEOM_DELAUNEY_STATS is defined.
+   const DelauneyStats& stats() const { return m_mesh.stats(); }
+
+ private:
+   using VertexIdx = typename internals::DelauneyMesh<T>::VertexIdx;
+   static constexpr VertexIdx NoIdx = internals::DelauneyMesh<T>::NoIdx;
+
+   // Adds a point at its current position to the mesh.
+   void insert(std::size_t idx);
+
+ private:
+   internals::DelauneyMesh<T> m_mesh;
+   // Position of each point that is not in the mesh. For the other points the
+   // mesh vertices are up to date.
+   std::vector<Point2<T>> m_positions;
+   // Mesh vertex of each point or NoIdx for points that are not in the mesh.
+   std::vector<VertexIdx> m_vertexOfPoint;
+   // Point of each mesh vertex. Updating the points in the order of their
+   // vertices keeps the walks to find them in the mesh short.
+   std::vector<std::size_t> m_pointOfVertex;
+   // Points that are not in the mesh.
+   std::vector<std::size_t> m_missingPoints;
+   // New positions in the order of the mesh vertices.
+   std::vector<Point2<T>> m_vertexPositions;
+};
+
+
+template <typename T>
+KineticDelauneyTriangulation<T>::KineticDelauneyTriangulation(
+   const std::vector<Point2<T>>& points)
+: m_positions{points}, m_vertexOfPoint(points.size(), NoIdx)
+{
+   // Insert the points along a Hilbert curve. This keeps consecutive vertices
+   // close to each other.
+   std::vector<std::pair<std::uint64_t, std::size_t>> order;
+   order.reserve(points.size());
+   if (const auto bounds = calcPathBounds<T>(points.begin(), points.end()); bounds)
+      for (std::size_t i = 0; i < points.size(); ++i)
+         order.emplace_back(hilbertIndex(points[i], *bounds), i);
+   std::sort(order.begin(), order.end());
+
+   m_mesh.init(points.size());
+   m_pointOfVertex.reserve(points.size());
+   for (const auto& entry : order)
+      insert(entry.second);
+}
+
+
+template <typename T>
+std::size_t KineticDelauneyTriangulation<T>::update(const std::vector<Point2<T>>& positions)
+{
+   assert(positions.size() == m_positions.size());
+
+   m_vertexPositions.resize(m_pointOfVertex.size());
+   for (VertexIdx v = 0; v < m_pointOfVertex.size(); ++v)
+      m_vertexPositions[v] = positions[m_pointOfVertex[v]];
+   const std::size_t numBlocked = m_mesh.moveAll(m_vertexPositions);
+
+   // Points that are not in the mesh take their new position regardless and try
+   // to join the mesh.
+   std::vector<std::size_t> missing;
+   missing.swap(m_missingPoints);
+   for (const std::size_t idx : missing)
+   {
+      m_positions[idx] = positions[idx];
+      insert(idx);
+   }
+
+   return numBlocked;
+}
+
+
+template <typename T> void KineticDelauneyTriangulation<T>::insert(std::size_t idx)
+{
+   const VertexIdx vertex = m_mesh.insert(m_positions[idx]);
+   m_vertexOfPoint[idx] = vertex;
+   if (vertex == NoIdx)
+   {
+      m_missingPoints.push_back(idx);
+      return;
+   }
+   // Points are never removed from the mesh, so it appends new vertices.
+   assert(vertex == m_pointOfVertex.size());
+   m_pointOfVertex.push_back(idx);
+}
+
+} // namespace geom
@@ -0,0 +1,320 @@
+//
+// geomcpp
+// Welding of points that are within a tolerance of each other.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include "essentutils/fputil.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Points after welding.
+template <typename T> struct WeldedPoints
+{
+   // The first point of each group of welded points. Ordered by their first
+   // occurrence in the original points.
+   std::vector<Point2<T>> points;
+   // For each original point the index of the welded point that it belongs to.
+   std::vector<std::uint32_t> mapping;
+};
+
+
+///////////////////
+
+// Welds points that are within a tolerance of each other into a single point.
+// Used to remove duplicates before triangulating points or tesselating them
+// into Voronoi tiles. The mapping to the welded points allows to transfer data
+// from the original points to the results.
+// - The points are hashed into a grid of cells. Only occupied cells are stored,
+//   so the grid works for any extent of the points. The cells are sized for
+//   about one point each but at least twice as large as the tolerance. Most
+//   points only have to look into their own cell for close points. Overall
+//   this takes O(n) expected time.
+// - Without tolerance each distinct point is a cell of its own.
+// - Each point is welded to the first point that is within the tolerance along
+//   both axes. Points that are welded to a point that is itself welded to an
+//   earlier point end up at that earlier point, so chains of close points are
+//   welded into a single point.
+// - Finding the close points can be split across multiple threads. The result
+//   does not depend on the number of threads.
+// The default tolerance is the epsilon that Point2 uses to compare coordinates.
+// For integer coordinates it is zero, i.e. only exact duplicates are welded.
+template <typename T> class PointWelder
+{
+ public:
+   static constexpr T DefaultTolerance =
+      static_cast<T>(sutil::FpTraits<sutil::FpType<T>>::epsilon);
+
+   static WeldedPoints<T> weld(const std::vector<Point2<T>>& points,
+                               T tolerance = DefaultTolerance,
+                               std::size_t numThreads = 1);
+
+ private:
+   using Fp = sutil::FpType<T>;
+   using Idx = std::uint32_t;
+   static constexpr Idx NoIdx = std::numeric_limits<Idx>::max();
+
+   // Minimal number of points that are worth running on a separate thread.
+   static constexpr std::size_t MinParallelPoints = 10000;
+
+   // Occupied grid cell. The points of a cell are linked in ascending order.
+   struct Cell
+   {
+      std::int64_t x = 0;
+      std::int64_t y = 0;
+      Idx first = NoIdx;
+      Idx last = NoIdx;
+   };
+
+   PointWelder(const std::vector<Point2<T>>& points, T tolerance);
+
+   WeldedPoints<T> run(std::size_t numThreads);
+   // Sorts the points into the cells of the grid.
+   void buildGrid();
+   // Finds the first close point for each point in the range [first, last).
+   void findFirstClose(std::size_t first, std::size_t last);
+   // Returns the index of the first point that is within the tolerance of the
+   // point at a given index. Returns the given index if no earlier point is.
+   Idx findFirstClose(Idx idx) const;
+   bool isClose(const Point2<T>& a, const Point2<T>& b) const;
+
+   // Chooses the cell size from the tolerance and the density of the points.
+   void chooseCellSize();
+   // Returns the cell index along one axis for a given coordinate.
+   std::int64_t cellCoord(Fp coord) const;
+   // Returns the slot of the hash table that holds a given cell or the empty
+   // slot where the cell would be stored.
+   std::size_t findSlot(std::int64_t x, std::int64_t y) const;
+
+ private:
+   const std::vector<Point2<T>>& m_points;
+   Fp m_tolerance = Fp(0);
+   Fp m_invCellSize = Fp(1);
+   // Hash table of occupied cells with open addressing. Its size is a power of
+   // two.
+   std::vector<Cell> m_cells;
+   std::size_t m_slotMask = 0;
+   // Next point in the same cell for each point.
+   std::vector<Idx> m_next;
+   std::vector<Idx> m_firstClose;
+};
+
+
+template <typename T>
+WeldedPoints<T> PointWelder<T>::weld(const std::vector<Point2<T>>& points, T tolerance,
+                                     std::size_t numThreads)
+{
+   assert(points.size() < NoIdx);
+   assert(tolerance >= T(0));
+   return PointWelder{points, tolerance}.run(numThreads);
+}
+
+
+template <typename T>
+PointWelder<T>::PointWelder(const std::vector<Point2<T>>& points, T tolerance)
+: m_points{points}, m_tolerance{static_cast<Fp>(tolerance)}
+{
+}
+
+
+template <typename T> WeldedPoints<T> PointWelder<T>::run(std::size_t numThreads)
+{
+   buildGrid();
+
+   const std::size_t numPoints = m_points.size();
+   numThreads = std::clamp<std::size_t>(numPoints / MinParallelPoints, 1,
+                                        std::max<std::size_t>(numThreads, 1));
+
+   // Each thread handles a consecutive range of points. The grid is only read.
+   m_firstClose.resize(numPoints);
+   std::vector<std::future<void>> threads;
+   for (std::size_t i = 1; i < numThreads; ++i)
+   {
+      threads.push_back(
+         std::async(std::launch::async, [this, i, numThreads, numPoints]() {
+            findFirstClose(i * numPoints / numThreads, (i + 1) * numPoints / numThreads);
+         }));
+   }
+   findFirstClose(0, numPoints / numThreads);
+   for (auto& thread : threads)
+      thread.get();
+
+   // The first close point of each point comes before it, so its welded point
+   // is already known.
+   WeldedPoints<T> result;
+   result.mapping.resize(numPoints);
+   for (std::size_t i = 0; i < numPoints; ++i)
+   {
+      const Idx first = m_firstClose[i];
+      if (first == i)
+      {
+         result.mapping[i] = static_cast<Idx>(result.points.size());
+         result.points.push_back(m_points[i]);
+      }
+      else
+      {
+         result.mapping[i] = result.mapping[first];
+      }
+   }
+   return result;
+}
+
+
+template <typename T> void PointWelder<T>::chooseCellSize()
+{
+   if (m_tolerance == Fp(0) || m_points.empty())
+      return;
+
+   Fp left = static_cast<Fp>(m_points[0].x());
+   Fp right = left;
+   Fp top = static_cast<Fp>(m_points[0].y());
+   Fp bottom = top;
+   for (const Point2<T>& pt : m_points)
+   {
+      left = std::min(left, static_cast<Fp>(pt.x()));
+      right = std::max(right, static_cast<Fp>(pt.x()));
+      top = std::min(top, static_cast<Fp>(pt.y()));
+      bottom = std::max(bottom, static_cast<Fp>(pt.y()));
+   }
+
+   // Size for one point per cell on average. Far away outliers inflate the
+   // bounds, so the size is limited to a multiple of the tolerance.
+   const Fp width = right - left;
+   const Fp height = bottom - top;
+   const Fp numPoints = static_cast<Fp>(m_points.size());
+   Fp cellSize = width > Fp(0) && height > Fp(0) ? std::sqrt(width * height / numPoints)
+                                                 : std::max(width, height) / numPoints;
+   cellSize = std::clamp(cellSize, Fp(2) * m_tolerance, Fp(64) * m_tolerance);
+   m_invCellSize = Fp(1) / cellSize;
+}
+
+
+template <typename T> void PointWelder<T>::buildGrid()
+{
+   chooseCellSize();
+
+   // Keep the hash table at most half full.
+   std::size_t numSlots = 16;
+   while (numSlots < 2 * m_points.size())
+      numSlots *= 2;
+   m_cells.assign(numSlots, Cell{});
+   m_slotMask = numSlots - 1;
+   m_next.assign(m_points.size(), NoIdx);
+
+   for (Idx i = 0; i < m_points.size(); ++i)
+   {
+      const std::int64_t x = cellCoord(static_cast<Fp>(m_points[i].x()));
+      const std::int64_t y = cellCoord(static_cast<Fp>(m_points[i].y()));
+      Cell& cell = m_cells[findSlot(x, y)];
+      if (cell.first == NoIdx)
+      {
+         cell = Cell{x, y, i, i};
+      }
+      else
+      {
+         m_next[cell.last] = i;
+         cell.last = i;
+      }
+   }
+}
+
+
+template <typename T>
+void PointWelder<T>::findFirstClose(std::size_t first, std::size_t last)
+{
+   for (std::size_t i = first; i < last; ++i)
+      m_firstClose[i] = findFirstClose(static_cast<Idx>(i));
+}
+
+
+template <typename T>
+typename PointWelder<T>::Idx PointWelder<T>::findFirstClose(Idx idx) const
+{
+   // Visit the cells that overlap the box of the tolerance around the point.
+   const Point2<T>& pt = m_points[idx];
+   const Fp x = static_cast<Fp>(pt.x());
+   const Fp y = static_cast<Fp>(pt.y());
+   const std::int64_t left = cellCoord(x - m_tolerance);
+   const std::int64_t right = cellCoord(x + m_tolerance);
+   const std::int64_t top = cellCoord(y - m_tolerance);
+   const std::int64_t bottom = cellCoord(y + m_tolerance);
+
+   Idx result = idx;
+   for (std::int64_t cy = top; cy <= bottom; ++cy)
+   {
+      for (std::int64_t cx = left; cx <= right; ++cx)
+      {
+         const Cell& cell = m_cells[findSlot(cx, cy)];
+         // The points of a cell are in ascending order. The first close point
+         // is the earliest one of the cell.
+         for (Idx i = cell.first; i < result; i = m_next[i])
+         {
+            if (isClose(m_points[i], pt))
+            {
+               result = i;
+               break;
+            }
+         }
+      }
+   }
+   return result;
+}
+
+
+template <typename T>
+bool PointWelder<T>::isClose(const Point2<T>& a, const Point2<T>& b) const
+{
+   return std::abs(static_cast<Fp>(a.x()) - static_cast<Fp>(b.x())) <= m_tolerance &&
+          std::abs(static_cast<Fp>(a.y()) - static_cast<Fp>(b.y())) <= m_tolerance;
+}
+
+
+template <typename T> std::int64_t PointWelder<T>::cellCoord(Fp coord) const
+{
+   // Without tolerance the coordinate itself identifies the cell. Adding zero
+   // turns -0 into 0.
+   if (m_tolerance == Fp(0))
+   {
+      const double value = static_cast<double>(coord) + 0.0;
+      std::int64_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return bits;
+   }
+
+   // Clamp far away coordinates into the range of the cell indices. Their
+   // points share the outermost cells.
+   constexpr Fp Limit = Fp(std::int64_t(1) << 60);
+   const Fp pos = std::floor(coord * m_invCellSize);
+   return static_cast<std::int64_t>(std::clamp(pos, -Limit, Limit));
+}
+
+
+template <typename T>
+std::size_t PointWelder<T>::findSlot(std::int64_t x, std::int64_t y) const
+{
+   std::uint64_t hash = static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ull ^
+                        static_cast<std::uint64_t>(y) * 0xC2B2AE3D27D4EB4Full;
+   hash ^= hash >> 29;
+
+   std::size_t slot = static_cast<std::size_t>(hash) & m_slotMask;
+   while (m_cells[slot].first != NoIdx && (m_cells[slot].x != x || m_cells[slot].y != y))
+      slot = (slot + 1) & m_slotMask;
+   return slot;
+}
+
+} // namespace geom
@@ -11,6 +11,7 @@
 #include "line_intersection2_ct.h"
 #include "line_seg2_ct.h"
 #include "point2.h"
+#include "predicates.h"
 #include "rect.h"
 #include "essentutils/math_util.h"
 #include "essentutils/type_traits_util.h"
@@ -234,11 +235,8 @@ bool isPointInsideConvexPolygon(const Poly2<T>& poly, const Point2<U>& pt)
    const std::size_t numVert = poly.size();
    for (std::size_t i = 0; i < numVert; ++i)
    {
-      Vec2<T> v(pt, poly[i]);
       const std::size_t next = (i + 1) % numVert;
-      Vec2<T> w(pt, poly[next]);
-
-      Sign curOrientation = sutil::sign(perpDot(v, w));
+      Sign curOrientation = sutil::sign(orient2d(pt, poly[i], poly[next]));
 
       if (curOrientation == Sign::None && poly.edge(i).isPointOnLine(pt))
       {
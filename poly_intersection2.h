@@ -10,6 +10,7 @@
 #include "line_seg2_ct.h"
 #include "point2.h"
 #include "poly2.h"
+#include "predicates.h"
 #include "vec2.h"
 
 namespace geom
@@ -102,13 +103,14 @@ template <typename T> class Traversal
    // considered 'inside'.
    bool isPointOnInside(const Point2<T>& pt)
    {
-      const Vec2<T> v(m_curEdge.anchor(), pt);
-      return sutil::lessEqual<Fp>(perpDot(m_curEdge.direction(), v), 0.0);
+      // The current edge ends at the current point. Decide on the polygon's
+      // vertices instead of on the rounded edge direction.
+      return orient2d(m_poly[edgeIndex(m_ptIdx)], m_curPt, pt) <= 0;
    }
 
    bool isEdgeCcwOrCollinear(const ct::LineSeg2<T>& e)
    {
-      return sutil::lessEqual<Fp>(perpDot(m_curEdge.direction(), e.direction()), 0.0);
+      return robustPerpDot(m_curEdge.direction(), e.direction()) <= 0;
    }
 
    // Returns the index of the edge that the algorithm associates with a
@@ -240,7 +242,9 @@ Poly2<T> intersectConvexPolygons(const Poly2<T>& PIn, const Poly2<T>& QIn)
    Poly2<T> P = internals::makeCcw(PIn);
    Poly2<T> Q = internals::makeCcw(QIn);
 
-   int maxIter = 2 * static_cast<int>(P.numEdges() + Q.numEdges());
+   // Finding the first intersection can take up to a lap around both polygons.
+   // Tracing the intersection takes up to two more.
+   int maxIter = 3 * static_cast<int>(P.numEdges() + Q.numEdges());
    int numIter = 0;
 
    std::optional<Point2<T>> firstIsectPt;
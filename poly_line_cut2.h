@@ -11,6 +11,7 @@
 #include "line_seg2_ct.h"
 #include "point2.h"
 #include "poly2.h"
+#include "predicates.h"
 #include "vec2.h"
 #include "essentutils/fputil.h"
 #include <variant>
@@ -37,12 +38,12 @@ enum class Side
 // Calculates which side of a line a given point is on.
 template <typename T> Side calcSideOfLine(const ct::LineInf2<T>& l, const Point2<T>& pt)
 {
-   using Fp = sutil::FpType<T>;
-
-   const auto perpDotResult = perpDot(l.direction(), Vec2<T>(l.anchor(), pt));
-   if (sutil::less<Fp>(perpDotResult, 0))
+   // Decide on the original points. A vector from the anchor to the point
+   // would already be rounded.
+   const auto orientation = orient2d(l.anchor(), l.anchor() + l.direction(), pt);
+   if (orientation < 0)
       return Side::Left;
-   else if (sutil::greater<Fp>(perpDotResult, 0))
+   else if (orientation > 0)
       return Side::Right;
    return Side::Center;
 }
@@ -0,0 +1,362 @@
+//
+// geomcpp
+// Geometric predicates.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include "essentutils/fputil.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+
+namespace geom
+{
+///////////////////
+
+// Floating point type that predicates are evaluated in. At least double
+// precision to reduce the error for float coordinates.
+template <typename T> using PredicateFp = std::common_type_t<sutil::FpType<T>, double>;
+
+
+namespace internals
+{
+///////////////////
+
+// Exact floating point arithmetic on expansions.
+// An expansion represents a number exactly as the sum of floating point
+// components that don't overlap in their bits. The components are ordered by
+// increasing magnitude and zero components are eliminated. The sign of the
+// represented number is the sign of its last (largest) component.
+// Expansions live on the stack. Their capacity is the maximal number of
+// components that the operation producing them can generate, so that no
+// allocations are necessary when the exact predicates are evaluated.
+// Source:
+// Shewchuk - Adaptive precision floating-point arithmetic and fast robust
+// geometric predicates, Discrete & Computational Geometry, 1997
+template <typename Fp, std::size_t Capacity> struct Expansion
+{
+   // Returns a value with the same sign as the represented number.
+   Fp approximate() const { return size == 0 ? Fp(0) : components[size - 1]; }
+
+   // Uninitialized for performance.
+   std::array<Fp, Capacity> components;
+   std::size_t size = 0;
+};
+
+
+// Half of the machine epsilon. Bounds the relative error of a single rounded
+// operation.
+template <typename Fp> constexpr Fp roundingError()
+{
+   return std::numeric_limits<Fp>::epsilon() / 2;
+}
+
+
+// Calculates the sum of two numbers and the rounding error of the sum.
+template <typename Fp> void twoSum(Fp a, Fp b, Fp& sum, Fp& err)
+{
+   sum = a + b;
+   const Fp bVirtual = sum - a;
+   const Fp aVirtual = sum - bVirtual;
+   err = (a - aVirtual) + (b - bVirtual);
+}
+
+
+// Calculates the sum of two numbers and the rounding error of the sum.
+// Requires |a| >= |b|.
+template <typename Fp> void fastTwoSum(Fp a, Fp b, Fp& sum, Fp& err)
+{
+   sum = a + b;
+   err = b - (sum - a);
+}
+
+
+// Calculates the product of two numbers and the rounding error of the product.
+template <typename Fp> void twoProduct(Fp a, Fp b, Fp& product, Fp& err)
+{
+   product = a * b;
+   err = std::fma(a, b, -product);
+}
+
+
+// Adds two expansions by merging their components in order of increasing
+// magnitude. Returns the number of components written to the result.
+template <typename Fp>
+std::size_t sumExpansions(const Fp* e, std::size_t eSize, const Fp* f, std::size_t fSize,
+                          Fp* result)
+{
+   if (eSize == 0 || fSize == 0)
+   {
+      const Fp* src = eSize == 0 ? f : e;
+      const std::size_t srcSize = eSize == 0 ? fSize : eSize;
+      std::copy(src, src + srcSize, result);
+      return srcSize;
+   }
+
+   std::size_t ei = 0;
+   std::size_t fi = 0;
+   auto nextSmallest = [&]() {
+      if (fi == fSize || (ei < eSize && std::abs(e[ei]) < std::abs(f[fi])))
+         return e[ei++];
+      return f[fi++];
+   };
+
+   std::size_t size = 0;
+   Fp q = nextSmallest();
+   Fp err;
+   if (ei < eSize && fi < fSize)
+      fastTwoSum(nextSmallest(), q, q, err);
+   else
+      twoSum(q, nextSmallest(), q, err);
+   if (err != 0)
+      result[size++] = err;
+
+   while (ei < eSize || fi < fSize)
+   {
+      twoSum(q, nextSmallest(), q, err);
+      if (err != 0)
+         result[size++] = err;
+   }
+   if (q != 0 || size == 0)
+      result[size++] = q;
+
+   return size;
+}
+
+
+// Multiplies an expansion with a number. Returns the number of components
+// written to the result.
+template <typename Fp>
+std::size_t scaleExpansion(const Fp* e, std::size_t eSize, Fp b, Fp* result)
+{
+   if (eSize == 0 || b == 0)
+      return 0;
+
+   std::size_t size = 0;
+   Fp carry;
+   Fp err;
+   twoProduct(e[0], b, carry, err);
+   if (err != 0)
+      result[size++] = err;
+
+   for (std::size_t i = 1; i < eSize; ++i)
+   {
+      Fp product;
+      Fp productErr;
+      twoProduct(e[i], b, product, productErr);
+
+      Fp sum;
+      twoSum(carry, productErr, sum, err);
+      if (err != 0)
+         result[size++] = err;
+      fastTwoSum(product, sum, carry, err);
+      if (err != 0)
+         result[size++] = err;
+   }
+   if (carry != 0)
+      result[size++] = carry;
+
+   return size;
+}
+
+
+///////////////////
+
+// Returns the exact difference of two numbers.
+template <typename Fp> Expansion<Fp, 2> exactDiff(Fp a, Fp b)
+{
+   Fp diff;
+   Fp err;
+   twoSum(a, -b, diff, err);
+
+   Expansion<Fp, 2> result;
+   if (err != 0)
+      result.components[result.size++] = err;
+   if (diff != 0)
+      result.components[result.size++] = diff;
+   return result;
+}
+
+
+template <typename Fp, std::size_t M, std::size_t N>
+Expansion<Fp, M + N> add(const Expansion<Fp, M>& e, const Expansion<Fp, N>& f)
+{
+   Expansion<Fp, M + N> result;
+   result.size = sumExpansions(e.components.data(), e.size, f.components.data(), f.size,
+                               result.components.data());
+   return result;
+}
+
+
+template <typename Fp, std::size_t N> Expansion<Fp, N> negate(Expansion<Fp, N> e)
+{
+   for (std::size_t i = 0; i < e.size; ++i)
+      e.components[i] = -e.components[i];
+   return e;
+}
+
+
+template <typename Fp, std::size_t M, std::size_t N>
+Expansion<Fp, M + N> subtract(const Expansion<Fp, M>& e, const Expansion<Fp, N>& f)
+{
+   return add(e, negate(f));
+}
+
+
+template <typename Fp, std::size_t M, std::size_t N>
+Expansion<Fp, 2 * M * N> multiply(const Expansion<Fp, M>& e, const Expansion<Fp, N>& f)
+{
+   // Accumulate the scaled expansions alternating between two buffers.
+   Expansion<Fp, 2 * M * N> result;
+   Expansion<Fp, 2 * M * N> sum;
+   Expansion<Fp, 2 * M> scaled;
+   for (std::size_t i = 0; i < f.size; ++i)
+   {
+      scaled.size = scaleExpansion(e.components.data(), e.size, f.components[i],
+                                   scaled.components.data());
+      sum.size = sumExpansions(result.components.data(), result.size,
+                               scaled.components.data(), scaled.size,
+                               sum.components.data());
+      std::copy(sum.components.data(), sum.components.data() + sum.size,
+                result.components.data());
+      result.size = sum.size;
+   }
+   return result;
+}
+
+
+///////////////////
+
+template <typename T>
+PredicateFp<T> orient2dExact(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c)
+{
+   using Fp = PredicateFp<T>;
+   const auto acx = exactDiff(static_cast<Fp>(a.x()), static_cast<Fp>(c.x()));
+   const auto bcx = exactDiff(static_cast<Fp>(b.x()), static_cast<Fp>(c.x()));
+   const auto acy = exactDiff(static_cast<Fp>(a.y()), static_cast<Fp>(c.y()));
+   const auto bcy = exactDiff(static_cast<Fp>(b.y()), static_cast<Fp>(c.y()));
+
+   return subtract(multiply(acx, bcy), multiply(acy, bcx)).approximate();
+}
+
+
+template <typename T>
+PredicateFp<T> inCircleExact(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c,
+                             const Point2<T>& d)
+{
+   using Fp = PredicateFp<T>;
+   const auto adx = exactDiff(static_cast<Fp>(a.x()), static_cast<Fp>(d.x()));
+   const auto ady = exactDiff(static_cast<Fp>(a.y()), static_cast<Fp>(d.y()));
+   const auto bdx = exactDiff(static_cast<Fp>(b.x()), static_cast<Fp>(d.x()));
+   const auto bdy = exactDiff(static_cast<Fp>(b.y()), static_cast<Fp>(d.y()));
+   const auto cdx = exactDiff(static_cast<Fp>(c.x()), static_cast<Fp>(d.x()));
+   const auto cdy = exactDiff(static_cast<Fp>(c.y()), static_cast<Fp>(d.y()));
+
+   const auto aLift = add(multiply(adx, adx), multiply(ady, ady));
+   const auto bLift = add(multiply(bdx, bdx), multiply(bdy, bdy));
+   const auto cLift = add(multiply(cdx, cdx), multiply(cdy, cdy));
+
+   const auto bcDet = subtract(multiply(bdx, cdy), multiply(cdx, bdy));
+   const auto caDet = subtract(multiply(cdx, ady), multiply(adx, cdy));
+   const auto abDet = subtract(multiply(adx, bdy), multiply(bdx, ady));
+
+   return add(add(multiply(aLift, bcDet), multiply(bLift, caDet)),
+              multiply(cLift, abDet))
+      .approximate();
+}
+
+} // namespace internals
+
+
+///////////////////
+
+// The predicates first evaluate their determinant in floating point and
+// compare the result against a bound for its rounding error. Only if the
+// result is too close to zero to be trusted, the determinant is evaluated
+// again with exact arithmetic. The sign of the result is always exact. The
+// magnitude is approximate.
+// Source:
+// Shewchuk - Adaptive precision floating-point arithmetic and fast robust
+// geometric predicates, Discrete & Computational Geometry, 1997
+
+
+// Orientation of point c relative to the directed line from a to b.
+// Returns a positive value if c is left of the line (the points are ccw in the
+// cartesian coordinate system), a negative value if c is right of the line, and
+// zero if the points are collinear. The magnitude is about twice the area of
+// the triangle formed by the points.
+template <typename T>
+PredicateFp<T> orient2d(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c)
+{
+   using Fp = PredicateFp<T>;
+   constexpr Fp eps = internals::roundingError<Fp>();
+   constexpr Fp ErrorBound = (3 + 16 * eps) * eps;
+
+   const Fp left = (static_cast<Fp>(a.x()) - static_cast<Fp>(c.x())) *
+                   (static_cast<Fp>(b.y()) - static_cast<Fp>(c.y()));
+   const Fp right = (static_cast<Fp>(a.y()) - static_cast<Fp>(c.y())) *
+                    (static_cast<Fp>(b.x()) - static_cast<Fp>(c.x()));
+   const Fp det = left - right;
+
+   // Use the sum of the absolute terms as the bound's base instead of branching on
+   // the signs of the terms. It is slightly more conservative but cheaper.
+   const Fp errorBound = ErrorBound * (std::abs(left) + std::abs(right));
+   if (std::abs(det) >= errorBound)
+      return det;
+
+   return internals::orient2dExact(a, b, c);
+}
+
+
+// Position of point d relative to the circle through points a, b and c.
+// For points a, b, c in ccw order (cartesian coordinate system) returns a
+// positive value if d is inside the circle, a negative value if d is outside,
+// and zero if d is on the circle. The sign is reversed for cw points.
+template <typename T>
+PredicateFp<T> inCircle(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c,
+                        const Point2<T>& d)
+{
+   using Fp = PredicateFp<T>;
+   constexpr Fp eps = internals::roundingError<Fp>();
+   constexpr Fp ErrorBound = (10 + 96 * eps) * eps;
+
+   const Fp adx = static_cast<Fp>(a.x()) - static_cast<Fp>(d.x());
+   const Fp ady = static_cast<Fp>(a.y()) - static_cast<Fp>(d.y());
+   const Fp bdx = static_cast<Fp>(b.x()) - static_cast<Fp>(d.x());
+   const Fp bdy = static_cast<Fp>(b.y()) - static_cast<Fp>(d.y());
+   const Fp cdx = static_cast<Fp>(c.x()) - static_cast<Fp>(d.x());
+   const Fp cdy = static_cast<Fp>(c.y()) - static_cast<Fp>(d.y());
+
+   const Fp bdxcdy = bdx * cdy;
+   const Fp cdxbdy = cdx * bdy;
+   const Fp cdxady = cdx * ady;
+   const Fp adxcdy = adx * cdy;
+   const Fp adxbdy = adx * bdy;
+   const Fp bdxady = bdx * ady;
+
+   const Fp aLift = adx * adx + ady * ady;
+   const Fp bLift = bdx * bdx + bdy * bdy;
+   const Fp cLift = cdx * cdx + cdy * cdy;
+
+   const Fp det =
+      aLift * (bdxcdy - cdxbdy) + bLift * (cdxady - adxcdy) + cLift * (adxbdy - bdxady);
+
+   const Fp permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * aLift +
+                        (std::abs(cdxady) + std::abs(adxcdy)) * bLift +
+                        (std::abs(adxbdy) + std::abs(bdxady)) * cLift;
+   // A zero permanent means that all terms are zero, e.g. because d coincides
+   // with one of the other points.
+   if (std::abs(det) > ErrorBound * permanent || permanent == 0)
+      return det;
+
+   return internals::inCircleExact(a, b, c, d);
+}
+
+} // namespace geom
@@ -0,0 +1,13 @@
+//
+// geomcpp allocation tests
+// Counter for heap allocations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include <cstddef>
+
+// Returns the number of heap allocations that the program has made so far.
+// Counted by the global allocation functions of the allocation test program.
+std::size_t numAllocations();
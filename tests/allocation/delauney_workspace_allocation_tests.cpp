@@ -0,0 +1,96 @@
+//
+// geomcpp allocation tests
+// Allocation tests for the reusable Delauney triangulation workspace.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_workspace_allocation_tests.h"
+#include "allocation_counter.h"
+#include "delauney_workspace.h"
+#include "point2.h"
+#include "test_util.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+void testSteadyStateAllocations()
+{
+   {
+      const std::string caseLabel = "DelauneyWorkspace steady state allocations";
+
+      using Fp = double;
+
+      std::vector<std::vector<Point2<Fp>>> pointSets;
+      for (const std::size_t n : {50, 200, 120, 3, 200})
+         pointSets.push_back(makeRandomPoints<Fp>(n, 4000 + n));
+
+      // The first round grows the buffers.
+      DelauneyWorkspace<Fp> workspace;
+      for (const auto& points : pointSets)
+      {
+         workspace.triangulate(points);
+         workspace.triangulateIndexed(points, true);
+      }
+
+      const std::size_t numBefore = numAllocations();
+      std::size_t numTriangles = 0;
+      for (std::size_t round = 0; round < 3; ++round)
+      {
+         for (const auto& points : pointSets)
+         {
+            numTriangles += workspace.triangulate(points).size();
+            numTriangles += workspace.triangulateIndexed(points, true).numTriangles();
+         }
+      }
+      const std::size_t numAfter = numAllocations();
+
+      VERIFY(numTriangles > 0, caseLabel);
+      VERIFY(numAfter == numBefore, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyWorkspace allocations after reserve";
+
+      using Fp = float;
+
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(100, 5555);
+
+      DelauneyWorkspace<Fp> workspace;
+      workspace.reserve(200);
+      workspace.triangulate(points);
+
+      const std::size_t numBefore = numAllocations();
+      workspace.triangulate(points);
+      workspace.triangulate(points.begin(), points.begin() + 50);
+      const std::size_t numAfter = numAllocations();
+
+      VERIFY(numAfter == numBefore, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyWorkspace allocations are counted";
+
+      using Fp = double;
+
+      // Guards against a counter that doesn't count anything.
+      const std::size_t numBefore = numAllocations();
+      DelauneyWorkspace<Fp> workspace;
+      workspace.triangulate(makeRandomPoints<Fp>(100, 6666));
+
+      VERIFY(numAllocations() > numBefore, caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDelauneyWorkspaceAllocations()
+{
+   testSteadyStateAllocations();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp allocation tests
+// Allocation tests for the reusable Delauney triangulation workspace.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDelauneyWorkspaceAllocations();
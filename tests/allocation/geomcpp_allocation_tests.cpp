@@ -0,0 +1,62 @@
+//
+// geomcpp allocation tests
+// Tests that count heap allocations. They replace the global allocation
+// functions, so they run as their own program instead of as part of the
+// geomcpp tests.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "allocation_counter.h"
+#include "delauney_workspace_allocation_tests.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+
+namespace
+{
+///////////////////
+
+std::atomic<std::size_t> allocationCount{0};
+
+} // namespace
+
+
+std::size_t numAllocations()
+{
+   return allocationCount;
+}
+
+
+// Replace the global allocation functions to count the allocations. The array
+// and nothrow versions forward to these.
+void* operator new(std::size_t size)
+{
+   ++allocationCount;
+   if (void* mem = std::malloc(size > 0 ? size : 1))
+      return mem;
+   throw std::bad_alloc{};
+}
+
+
+void operator delete(void* mem) noexcept
+{
+   std::free(mem);
+}
+
+
+void operator delete(void* mem, std::size_t) noexcept
+{
+   std::free(mem);
+}
+
+
+int main()
+{
+   testDelauneyWorkspaceAllocations();
+
+   std::cout << "geomcpp allocation tests finished.\n";
+   return EXIT_SUCCESS;
+}
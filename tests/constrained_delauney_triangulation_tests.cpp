@@ -0,0 +1,282 @@
+//
+// geomcpp tests
+// Tests for constrained Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "constrained_delauney_triangulation_tests.h"
+#include "constrained_delauney_triangulation.h"
+#include "delauney_triangulation.h"
+#include "indexed_triangulation.h"
+#include "line_seg2_ct.h"
+#include "point2.h"
+#include "test_util.h"
+#include "triangle.h"
+#include "essentutils/fputil.h"
+#include <string>
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+template <typename T> ct::LineSeg2<T> makeSegment(T x0, T y0, T x1, T y1)
+{
+   return ct::LineSeg2<T>{Point2<T>{x0, y0}, Point2<T>{x1, y1}};
+}
+
+
+// Creates the segments of a closed polygon.
+template <typename T>
+std::vector<ct::LineSeg2<T>> makeOutline(const std::vector<Point2<T>>& corners)
+{
+   std::vector<ct::LineSeg2<T>> segments;
+   for (std::size_t i = 0; i < corners.size(); ++i)
+      segments.emplace_back(corners[i], corners[(i + 1) % corners.size()]);
+   return segments;
+}
+
+
+template <typename T> double calcArea(const std::vector<Triangle<T>>& triangles)
+{
+   double area = 0.0;
+   for (const auto& t : triangles)
+      area += static_cast<double>(t.area());
+   return area;
+}
+
+
+// Checks if an indexed triangulation has an edge between two given points.
+template <typename T>
+bool hasEdge(const IndexedTriangulation<T>& triangulation, const Point2<T>& a,
+             const Point2<T>& b)
+{
+   for (std::size_t i = 0; i < triangulation.numTriangles(); ++i)
+   {
+      for (std::size_t e = 0; e < 3; ++e)
+      {
+         const Point2<T>& from = triangulation.vertices[triangulation.indices[3 * i + e]];
+         const Point2<T>& to =
+            triangulation.vertices[triangulation.indices[3 * i + (e + 1) % 3]];
+         if ((from == a && to == b) || (from == b && to == a))
+            return true;
+      }
+   }
+   return false;
+}
+
+
+///////////////////
+
+void testTriangulate()
+{
+   {
+      const std::string caseLabel = "ConstrainedDelauneyTriangulation::triangulate";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> samples = makeRandomPoints<Fp>(500, 1234);
+      const Point2<Fp> a{1.0, 2.0};
+      const Point2<Fp> b{99.0, 97.0};
+      ConstrainedDelauneyTriangulation<Fp> cdt{samples, {{a, b}}};
+      const IndexedTriangulation<Fp> result = cdt.triangulateIndexed();
+
+      VERIFY(hasEdge(result, a, b), caseLabel);
+
+      // Constraints don't change the number of triangles of a triangulation.
+      VERIFY(result.numTriangles() ==
+                DelauneyTriangulation<Fp>{result.vertices}.triangulate().size(),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for area of hull";
+
+      using Fp = float;
+
+      std::vector<Point2<Fp>> samples = makeRandomPoints<Fp>(300, 2345);
+      samples.insert(samples.end(), {{0.0f, 0.0f}, {100.0f, 0.0f}, {100.0f, 100.0f},
+                                     {0.0f, 100.0f}});
+      ConstrainedDelauneyTriangulation<Fp> cdt{samples,
+                                               {makeSegment(5.0f, 50.0f, 95.0f, 51.0f),
+                                                makeSegment(50.0f, 5.0f, 51.0f, 95.0f)}};
+
+      VERIFY(fpEqual(calcArea(cdt.triangulate()), 10000.0, 0.01), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for crossing segments";
+
+      using Fp = double;
+
+      ConstrainedDelauneyTriangulation<Fp> cdt{
+         makeRandomPoints<Fp>(200, 3456),
+         {makeSegment(10.0, 10.0, 90.0, 90.0), makeSegment(10.0, 90.0, 90.0, 10.0)}};
+      const IndexedTriangulation<Fp> result = cdt.triangulateIndexed();
+
+      // The segments are split at their intersection.
+      const Point2<Fp> center{50.0, 50.0};
+      VERIFY(hasEdge(result, {10.0, 10.0}, center), caseLabel);
+      VERIFY(hasEdge(result, center, {90.0, 90.0}), caseLabel);
+      VERIFY(hasEdge(result, {10.0, 90.0}, center), caseLabel);
+      VERIFY(hasEdge(result, center, {90.0, 10.0}), caseLabel);
+      VERIFY(result.vertices.size() == 205, caseLabel);
+      VERIFY(cdt.failedSegments().empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate without segments";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> samples = makeRandomPoints<Fp>(300, 4567);
+      ConstrainedDelauneyTriangulation<Fp> cdt{samples, {}};
+      const auto result = cdt.triangulate();
+
+      VERIFY(result.size() == DelauneyTriangulation<Fp>{samples}.triangulate().size(),
+             caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(result), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for collinear points";
+
+      using Fp = double;
+
+      ConstrainedDelauneyTriangulation<Fp> cdt{{{1.0, 1.0}, {2.0, 2.0}},
+                                               {makeSegment(0.0, 0.0, 3.0, 3.0)}};
+
+      VERIFY(cdt.triangulate().empty(), caseLabel);
+      VERIFY(cdt.triangulateIndexed().numTriangles() == 0, caseLabel);
+   }
+}
+
+
+void testEnclosedRegion()
+{
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for enclosed polygon";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> outline{
+         {20.0, 20.0}, {80.0, 20.0}, {80.0, 80.0}, {50.0, 50.0}, {20.0, 80.0}};
+      ConstrainedDelauneyTriangulation<Fp> cdt{makeRandomPoints<Fp>(500, 5678),
+                                               makeOutline(outline)};
+
+      // Square minus the notch at the top.
+      VERIFY(fpEqual(calcArea(cdt.triangulate(ConstrainedRegion::Enclosed)),
+                     3600.0 - 900.0, 1e-6),
+             caseLabel);
+      VERIFY(fpEqual(calcArea(cdt.triangulate(ConstrainedRegion::ConvexHull)),
+                     calcArea(DelauneyTriangulation<Fp>{makeRandomPoints<Fp>(500, 5678)}
+                                 .triangulate()),
+                     1e-6),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for polygon with hole";
+
+      using Fp = double;
+
+      std::vector<ct::LineSeg2<Fp>> segments = makeOutline<Fp>(
+         {{10.0, 10.0}, {90.0, 10.0}, {90.0, 90.0}, {10.0, 90.0}});
+      const std::vector<ct::LineSeg2<Fp>> hole = makeOutline<Fp>(
+         {{40.0, 40.0}, {40.0, 60.0}, {60.0, 60.0}, {60.0, 40.0}});
+      segments.insert(segments.end(), hole.begin(), hole.end());
+      ConstrainedDelauneyTriangulation<Fp> cdt{makeRandomPoints<Fp>(500, 6789),
+                                               segments};
+
+      const auto result = cdt.triangulateIndexed(true, ConstrainedRegion::Enclosed);
+      double area = 0.0;
+      for (std::size_t i = 0; i < result.numTriangles(); ++i)
+         area += result.triangle(i).area();
+      VERIFY(fpEqual(area, 6400.0 - 400.0, 1e-6), caseLabel);
+
+      // Triangles outside of the region are not referenced as neighbors.
+      for (const auto neighbor : result.neighbors)
+         VERIFY(neighbor == IndexedTriangulation<Fp>::NoNeighbor ||
+                   neighbor < result.numTriangles(),
+                caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for polygon on hull";
+
+      using Fp = float;
+
+      ConstrainedDelauneyTriangulation<Fp> cdt{
+         {{2.0f, 3.0f}, {5.0f, 5.0f}, {7.0f, 1.0f}},
+         makeOutline<Fp>({{0.0f, 0.0f}, {10.0f, 0.0f}, {10.0f, 10.0f}, {0.0f, 10.0f}})};
+
+      VERIFY(fpEqual(calcArea(cdt.triangulate(ConstrainedRegion::Enclosed)), 100.0),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::triangulate for open segments";
+
+      using Fp = double;
+
+      ConstrainedDelauneyTriangulation<Fp> cdt{makeRandomPoints<Fp>(100, 7890),
+                                               {makeSegment(20.0, 20.0, 80.0, 70.0)}};
+
+      // A single road does not enclose anything.
+      VERIFY(cdt.triangulate(ConstrainedRegion::Enclosed).empty(), caseLabel);
+   }
+}
+
+
+void testFailedSegments()
+{
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::failedSegments for overflowing intersection";
+
+      using Fp = float;
+
+      // Calculating the intersection of the segments overflows, so the second
+      // segment cannot be split.
+      const Fp s = 1e19f;
+      ConstrainedDelauneyTriangulation<Fp> cdt{
+         {}, {makeSegment(0.0f, 0.0f, 4.0f * s, 4.0f * s),
+              makeSegment(0.0f, 4.0f * s, 4.0f * s, 0.0f)}};
+      const IndexedTriangulation<Fp> result = cdt.triangulateIndexed();
+
+      VERIFY(cdt.failedSegments() == std::vector<std::size_t>{1}, caseLabel);
+      VERIFY(hasEdge(result, {0.0f, 0.0f}, {4.0f * s, 4.0f * s}), caseLabel);
+      VERIFY(result.vertices.size() == 4, caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "ConstrainedDelauneyTriangulation::failedSegments is reset";
+
+      using Fp = float;
+
+      const Fp s = 1e19f;
+      ConstrainedDelauneyTriangulation<Fp> cdt{
+         {}, {makeSegment(0.0f, 0.0f, 4.0f * s, 4.0f * s),
+              makeSegment(0.0f, 4.0f * s, 4.0f * s, 0.0f)}};
+      cdt.triangulate();
+      cdt.triangulate(ConstrainedRegion::Enclosed);
+
+      VERIFY(cdt.failedSegments().size() == 1, caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testConstrainedDelauneyTriangulation()
+{
+   testTriangulate();
+   testEnclosedRegion();
+   testFailedSegments();
+}
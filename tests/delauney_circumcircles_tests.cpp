@@ -0,0 +1,201 @@
+//
+// geomcpp tests
+// Tests for cached circumcircles of Delauney triangles.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_circumcircles_tests.h"
+#include "delauney_circumcircles.h"
+#include "point2.h"
+#include "predicates.h"
+#include "test_util.h"
+#include "essentutils/rand_util.h"
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+template <typename T> using Cache = internals::CircumcircleCache<T>;
+using internals::CircleSide;
+
+
+// Checks that a given side does not contradict the exact in-circle predicate
+// for ccw points a, b, c.
+template <typename T>
+bool isSideConsistent(CircleSide side, const Point2<T>& a, const Point2<T>& b,
+                      const Point2<T>& c, const Point2<T>& pt)
+{
+   const auto exact = inCircle(a, b, c, pt);
+   if (side == CircleSide::Inside)
+      return exact > 0;
+   if (side == CircleSide::Outside)
+      return exact <= 0;
+   return true;
+}
+
+
+// Fills a cache with random ccw triangles and checks the results for random
+// points against the exact predicate.
+template <typename T> bool verifyRandomTriangles(std::size_t n)
+{
+   Random<T> rand{T(-100), T(100), 3333};
+   const auto randomPoint = [&rand]() {
+      const T x = rand.next();
+      return Point2<T>{x, rand.next()};
+   };
+
+   Cache<T> cache;
+   std::vector<std::array<Point2<T>, 3>> triangles;
+   while (triangles.size() < n)
+   {
+      const Point2<T> a = randomPoint();
+      Point2<T> b = randomPoint();
+      Point2<T> c = randomPoint();
+      const auto orientation = orient2d(a, b, c);
+      if (orientation == 0)
+         continue;
+      if (orientation < 0)
+         std::swap(b, c);
+
+      cache.add(a, b, c);
+      triangles.push_back({a, b, c});
+   }
+
+   std::size_t numDecided = 0;
+   for (std::size_t p = 0; p < 50; ++p)
+   {
+      const Point2<T> pt = randomPoint();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         const auto& t = triangles[i];
+         const CircleSide side = cache.side(i, pt);
+         if (!isSideConsistent(side, t[0], t[1], t[2], pt))
+            return false;
+         if (side != CircleSide::Unknown)
+            ++numDecided;
+      }
+   }
+
+   // Almost all random points are far enough from the circles to be decided
+   // from the cached data.
+   return numDecided > 45 * n;
+}
+
+
+///////////////////
+
+void testAdd()
+{
+   {
+      const std::string caseLabel = "CircumcircleCache::add";
+
+      using Fp = double;
+
+      Cache<Fp> cache;
+      cache.add({0.0, 0.0}, {2.0, 0.0}, {0.0, 2.0});
+      cache.add({10.0, 10.0}, {12.0, 10.0}, {10.0, 12.0});
+
+      VERIFY(cache.size() == 2, caseLabel);
+      VERIFY(cache.side(0, {1.0, 1.0}) == CircleSide::Inside, caseLabel);
+      VERIFY(cache.side(1, {1.0, 1.0}) == CircleSide::Outside, caseLabel);
+      VERIFY(cache.side(1, {11.0, 11.0}) == CircleSide::Inside, caseLabel);
+   }
+   {
+      const std::string caseLabel = "CircumcircleCache::clear";
+
+      using Fp = float;
+
+      Cache<Fp> cache;
+      cache.add({0.0f, 0.0f}, {2.0f, 0.0f}, {0.0f, 2.0f});
+      cache.clear();
+
+      VERIFY(cache.size() == 0, caseLabel);
+   }
+}
+
+
+void testSide()
+{
+   {
+      const std::string caseLabel =
+         "CircumcircleCache::side for points inside and outside";
+
+      using Fp = double;
+
+      // Circle around (1, 1) with radius sqrt(2).
+      Cache<Fp> cache;
+      cache.add({0.0, 0.0}, {2.0, 0.0}, {0.0, 2.0});
+
+      VERIFY(cache.side(0, {1.0, 1.0}) == CircleSide::Inside, caseLabel);
+      VERIFY(cache.side(0, {2.0, 1.9}) == CircleSide::Inside, caseLabel);
+      VERIFY(cache.side(0, {3.0, 3.0}) == CircleSide::Outside, caseLabel);
+      VERIFY(cache.side(0, {-1.0, 0.0}) == CircleSide::Outside, caseLabel);
+   }
+   {
+      const std::string caseLabel = "CircumcircleCache::side for point on circle";
+
+      using Fp = double;
+
+      Cache<Fp> cache;
+      cache.add({0.0, 0.0}, {2.0, 0.0}, {0.0, 2.0});
+
+      // Cocircular points cannot be decided from the cached data.
+      VERIFY(cache.side(0, {2.0, 2.0}) == CircleSide::Unknown, caseLabel);
+   }
+   {
+      const std::string caseLabel = "CircumcircleCache::side for degenerate triangle";
+
+      using Fp = float;
+
+      Cache<Fp> cache;
+      cache.add({0.0f, 0.0f}, {1.0f, 1.0f}, {2.0f, 2.0f});
+
+      VERIFY(cache.side(0, {0.5f, 0.5f}) == CircleSide::Unknown, caseLabel);
+      VERIFY(cache.side(0, {100.0f, -5.0f}) == CircleSide::Unknown, caseLabel);
+   }
+   {
+      const std::string caseLabel = "CircumcircleCache::side for far-off coordinates";
+
+      using Fp = double;
+
+      // Small triangle far from the origin.
+      const Point2<Fp> a{1e7, 1e7};
+      const Point2<Fp> b{1e7 + 1.0, 1e7};
+      const Point2<Fp> c{1e7, 1e7 + 1.0};
+      Cache<Fp> cache;
+      cache.add(a, b, c);
+
+      const Point2<Fp> inside{1e7 + 0.5, 1e7 + 0.5};
+      const Point2<Fp> outside{1e7 + 2.0, 1e7 + 2.0};
+      VERIFY(cache.side(0, inside) == CircleSide::Inside, caseLabel);
+      VERIFY(cache.side(0, outside) == CircleSide::Outside, caseLabel);
+      VERIFY(isSideConsistent(cache.side(0, b.offset(0.0, 1.0)), a, b, c,
+                              b.offset(0.0, 1.0)),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "CircumcircleCache::side for random triangles";
+
+      VERIFY(verifyRandomTriangles<double>(101), caseLabel);
+      VERIFY(verifyRandomTriangles<float>(101), caseLabel);
+      VERIFY(verifyRandomTriangles<long double>(20), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDelauneyCircumcircles()
+{
+   testAdd();
+   testSide();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for cached circumcircles of Delauney triangles.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDelauneyCircumcircles();
@@ -0,0 +1,154 @@
+//
+// geomcpp tests
+// Tests for the divide-and-conquer Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_divide_conquer_tests.h"
+#include "delauney_divide_conquer.h"
+#include "delauney_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include "test_util.h"
+#include "triangle.h"
+#include "essentutils/fputil.h"
+#include "essentutils/rand_util.h"
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+template <typename T> using DivideConquer = internals::DelauneyDivideConquer<T>;
+
+
+template <typename T>
+bool hasDegenerateTriangles(const std::vector<Triangle<T>>& triangles)
+{
+   for (const auto& t : triangles)
+      if (orient2d(t[0], t[1], t[2]) == 0)
+         return true;
+   return false;
+}
+
+
+void testTriangulate()
+{
+   {
+      const std::string caseLabel =
+         "DelauneyDivideConquer::triangulate for collinear points";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{
+         {0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}};
+      const auto triangles = DivideConquer<Fp>::triangulate(points);
+
+      VERIFY(triangles.empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyDivideConquer::triangulate for points with duplicates";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{
+         {0.0, 0.0}, {4.0, 0.0}, {0.0, 0.0}, {2.0, 3.0}, {4.0, 0.0}};
+      const auto triangles = DivideConquer<Fp>::triangulate(points);
+
+      VERIFY(triangles.size() == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyDivideConquer::triangulate for collinear and off-line points";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{
+         {0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}, {3.0, 0.0}, {1.5, 2.0}};
+      const auto triangles = DivideConquer<Fp>::triangulate(points);
+
+      VERIFY(triangles.size() == 3, caseLabel);
+      VERIFY(!hasDegenerateTriangles(triangles), caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyDivideConquer::triangulate for random points matches Bowyer-Watson";
+
+      using Fp = double;
+
+      Random<Fp> rand{Fp(0), Fp(100), 4444};
+      std::vector<Point2<Fp>> points;
+      for (std::size_t i = 0; i < 1000; ++i)
+      {
+         const Fp x = rand.next();
+         points.emplace_back(x, rand.next());
+      }
+      const auto triangles = DivideConquer<Fp>::triangulate(points);
+      const auto expected = DelauneyTriangulation<Fp>{points}.triangulate();
+
+      VERIFY(triangles.size() == expected.size(), caseLabel);
+      bool isSubset = true;
+      for (const auto& t : expected)
+         isSubset = isSubset && containsTriangle(triangles, t);
+      VERIFY(isSubset, caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+      VERIFY(!hasDegenerateTriangles(triangles), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyDivideConquer::triangulate for float points";
+
+      using Fp = float;
+
+      const std::vector<Point2<Fp>> points{
+         {0.0f, 0.0f}, {5.0f, 1.0f}, {3.0f, 4.0f}, {-1.0f, 3.0f}, {2.0f, 2.0f}};
+      const auto triangles = DivideConquer<Fp>::triangulate(points);
+
+      VERIFY(triangles.size() == 4, caseLabel);
+      VERIFY(!hasDegenerateTriangles(triangles), caseLabel);
+   }
+}
+
+
+void testTriangulateInParallel()
+{
+   {
+      const std::string caseLabel =
+         "DelauneyDivideConquer::triangulate with multiple threads matches serial result";
+
+      using Fp = double;
+
+      Random<Fp> rand{Fp(0), Fp(1000), 5555};
+      std::vector<Point2<Fp>> points;
+      for (std::size_t i = 0; i < 100000; ++i)
+      {
+         const Fp x = rand.next();
+         points.emplace_back(x, rand.next());
+      }
+      const auto serial = DivideConquer<Fp>::triangulate(points, 1);
+
+      const std::vector<std::size_t> threadCounts{2, 3, 4, 8};
+      for (std::size_t numThreads : threadCounts)
+      {
+         const auto parallel = DivideConquer<Fp>::triangulate(points, numThreads);
+         VERIFY(parallel == serial, caseLabel);
+      }
+   }
+}
+
+} // namespace
+
+
+void testDelauneyDivideConquer()
+{
+   testTriangulate();
+   testTriangulateInParallel();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for the divide-and-conquer Delauney triangulation.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDelauneyDivideConquer();
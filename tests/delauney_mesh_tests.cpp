@@ -0,0 +1,958 @@
+//
+// geomcpp tests
+// Tests for the Delauney triangulation mesh.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_mesh_tests.h"
+#include "delauney_mesh.h"
+#include "delauney_stats.h"
+#include "point2.h"
+#include "predicates.h"
+#include "test_util.h"
+#include "triangle.h"
+#include "vec2.h"
+#include "essentutils/fputil.h"
+#include "essentutils/rand_util.h"
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+template <typename T> using Mesh = internals::DelauneyMesh<T>;
+
+
+template <typename T> std::vector<Point2<T>> makeGridPoints(std::size_t n)
+{
+   std::vector<Point2<T>> points;
+   for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t j = 0; j < n; ++j)
+         points.emplace_back(static_cast<T>(i), static_cast<T>(j));
+   return points;
+}
+
+
+template <typename T> std::size_t countGhostTriangles(const Mesh<T>& mesh)
+{
+   std::size_t count = 0;
+   for (typename Mesh<T>::TriangleIdx i = 0; i < mesh.numTriangleSlots(); ++i)
+      if (!mesh.isRemoved(i) && mesh.isGhost(i))
+         ++count;
+   return count;
+}
+
+
+// Checks that no vertex of the mesh is inside the circumcircle of any solid
+// triangle.
+template <typename T> bool isDelauney(const Mesh<T>& mesh)
+{
+   using TriangleIdx = typename Mesh<T>::TriangleIdx;
+
+   for (TriangleIdx i = 0; i < mesh.numTriangleSlots(); ++i)
+   {
+      if (mesh.isRemoved(i) || mesh.isGhost(i))
+         continue;
+
+      const auto& t = mesh.triangle(i);
+      for (TriangleIdx j = 0; j < mesh.numTriangleSlots(); ++j)
+      {
+         if (mesh.isRemoved(j) || mesh.isGhost(j))
+            continue;
+         for (const auto v : mesh.triangle(j).vertices)
+            if (inCircle(mesh.vertex(t.vertices[0]), mesh.vertex(t.vertices[1]),
+                         mesh.vertex(t.vertices[2]), mesh.vertex(v)) > 0)
+               return false;
+      }
+   }
+
+   return true;
+}
+
+
+// Checks that each neighbor of each triangle references the triangle back and
+// shares the expected edge with it. The ghost triangles close off the hull, so
+// each triangle has three neighbors.
+template <typename T> bool areNeighborsConsistent(const Mesh<T>& mesh)
+{
+   using TriangleIdx = typename Mesh<T>::TriangleIdx;
+
+   for (TriangleIdx i = 0; i < mesh.numTriangleSlots(); ++i)
+   {
+      if (mesh.isRemoved(i))
+         continue;
+
+      const auto& t = mesh.triangle(i);
+      for (std::size_t e = 0; e < 3; ++e)
+      {
+         const TriangleIdx neighborIdx = t.neighbors[e];
+         if (neighborIdx == Mesh<T>::NoIdx || mesh.isRemoved(neighborIdx))
+            return false;
+
+         // The neighbor has to contain the shared edge in reverse direction.
+         const auto& n = mesh.triangle(neighborIdx);
+         const auto from = t.vertices[(e + 1) % 3];
+         const auto to = t.vertices[(e + 2) % 3];
+         bool hasSharedEdge = false;
+         for (std::size_t ne = 0; ne < 3; ++ne)
+         {
+            if (n.vertices[(ne + 1) % 3] == to && n.vertices[(ne + 2) % 3] == from)
+               hasSharedEdge = n.neighbors[ne] == i;
+         }
+         if (!hasSharedEdge)
+            return false;
+      }
+   }
+
+   return true;
+}
+
+
+// Checks if the mesh has a triangle with an edge between two given vertices.
+template <typename T>
+bool hasEdge(const Mesh<T>& mesh, typename Mesh<T>::VertexIdx a,
+             typename Mesh<T>::VertexIdx b)
+{
+   for (typename Mesh<T>::TriangleIdx i = 0; i < mesh.numTriangleSlots(); ++i)
+   {
+      if (mesh.isRemoved(i))
+         continue;
+      const auto& t = mesh.triangle(i);
+      for (std::size_t e = 0; e < 3; ++e)
+         if (t.vertices[e] == a && t.vertices[(e + 1) % 3] == b)
+            return true;
+   }
+   return false;
+}
+
+
+///////////////////
+
+void testInit()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::init";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(10);
+
+      VERIFY(mesh.numVertices() == 0, caseLabel);
+      VERIFY(mesh.numTriangleSlots() == 0, caseLabel);
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+      VERIFY(mesh.triangles().empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::init discards previous content";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(3);
+      mesh.insert({1.0, 1.0});
+      mesh.insert({5.0, 2.0});
+      mesh.insert({2.0, 6.0});
+      mesh.init(3);
+
+      VERIFY(mesh.numVertices() == 0, caseLabel);
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+   }
+}
+
+
+void testInsert()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for three points";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(3);
+      const Point2<Fp> a{1.0, 1.0};
+      const Point2<Fp> b{5.0, 2.0};
+      const Point2<Fp> c{2.0, 6.0};
+      const auto aIdx = mesh.insert(a);
+      mesh.insert(b);
+      mesh.insert(c);
+
+      VERIFY(mesh.numVertices() == 3, caseLabel);
+      VERIFY(mesh.vertex(aIdx) == a, caseLabel);
+      VERIFY(mesh.hasTriangles(), caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 3, caseLabel);
+
+      const std::vector<Triangle<Fp>> triangles = mesh.triangles();
+      VERIFY(triangles.size() == 1, caseLabel);
+      if (triangles.size() == 1)
+      {
+         VERIFY(triangles[0].hasVertex(a), caseLabel);
+         VERIFY(triangles[0].hasVertex(b), caseLabel);
+         VERIFY(triangles[0].hasVertex(c), caseLabel);
+      }
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for many points";
+
+      using Fp = float;
+
+      Mesh<Fp> mesh;
+      mesh.init(200);
+      for (const auto& pt : makeRandomPoints<Fp>(200, 2222))
+         mesh.insert(pt);
+
+      VERIFY(mesh.numVertices() == 200, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for point on existing edge";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      // On the diagonal of the square.
+      mesh.insert({2.0, 2.0});
+
+      VERIFY(mesh.triangles().size() == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for point on hull edge";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(4);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({2.0, 4.0});
+      mesh.insert({2.0, 0.0});
+
+      VERIFY(mesh.triangles().size() == 2, caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for duplicate point";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(2);
+      mesh.insert({1.0, 1.0});
+      const auto idx = mesh.insert({1.0, 1.0});
+
+      VERIFY(idx == Mesh<Fp>::NoIdx, caseLabel);
+      VERIFY(mesh.numVertices() == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for collinear points";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(6);
+      mesh.insert({2.0, 2.0});
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({1.0, 1.0});
+      mesh.insert({3.0, 3.0});
+
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+      VERIFY(mesh.triangles().empty(), caseLabel);
+      VERIFY(mesh.insert({3.0, 3.0}) == Mesh<Fp>::NoIdx, caseLabel);
+
+      // A point off the line creates a triangle for each line segment.
+      mesh.insert({0.0, 4.0});
+
+      VERIFY(mesh.hasTriangles(), caseLabel);
+      VERIFY(mesh.triangles().size() == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for grid points";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(100);
+      for (const auto& pt : makeGridPoints<Fp>(10))
+         mesh.insert(pt);
+
+      VERIFY(mesh.triangles().size() == 162, caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 36, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert for points far from origin";
+
+      using Fp = double;
+
+      // Points with a large offset but small spacing would lose precision
+      // relative to an enclosing triangle that is scaled to the bounds.
+      Mesh<Fp> mesh;
+      mesh.init(200);
+      for (const auto& pt : makeRandomPoints<Fp>(200, 2222, 1.0e7, 1.0e7 + 1.0))
+         mesh.insert(pt);
+
+      VERIFY(mesh.numVertices() == 200, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+}
+
+
+void testRemove()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::remove for point inside square";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      mesh.insert({2.0, 1.0});
+
+      VERIFY(mesh.remove({2.0, 1.0}), caseLabel);
+      VERIFY(mesh.triangles().size() == 2, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::remove for hull point";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      mesh.insert({2.0, 1.0});
+
+      VERIFY(mesh.remove({4.0, 4.0}), caseLabel);
+      VERIFY(mesh.triangles().size() == 3, caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 3, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::remove for point that is not a vertex";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(3);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+
+      VERIFY(!mesh.remove({3.0, 1.0}), caseLabel);
+      VERIFY(!mesh.remove({8.0, 1.0}), caseLabel);
+      VERIFY(mesh.triangles().size() == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::remove until points are collinear";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(4);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({2.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({2.0, 3.0});
+
+      VERIFY(mesh.remove({2.0, 3.0}), caseLabel);
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+      VERIFY(mesh.triangles().empty(), caseLabel);
+
+      // The remaining points are still part of the mesh.
+      VERIFY(mesh.insert({2.0, 0.0}) == Mesh<Fp>::NoIdx, caseLabel);
+      VERIFY(mesh.remove({4.0, 0.0}), caseLabel);
+      mesh.insert({2.0, -3.0});
+
+      VERIFY(mesh.triangles().size() == 1, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::remove for many points";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(200);
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(200, 2222);
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      bool isRemoved = true;
+      for (std::size_t i = 0; i < points.size(); i += 2)
+         isRemoved = isRemoved && mesh.remove(points[i]);
+
+      VERIFY(isRemoved, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::remove for all grid points";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(36);
+      const std::vector<Point2<Fp>> points = makeGridPoints<Fp>(6);
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      // Removing the points in order removes hull points first.
+      bool isRemoved = true;
+      bool isConsistent = true;
+      for (const auto& pt : points)
+      {
+         isRemoved = isRemoved && mesh.remove(pt);
+         isConsistent = isConsistent && areNeighborsConsistent(mesh) && isDelauney(mesh);
+      }
+
+      VERIFY(isRemoved, caseLabel);
+      VERIFY(isConsistent, caseLabel);
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::remove reuses vertex slots";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(100);
+      std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(100, 2222);
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      // Replace the points one after the other many times.
+      const std::vector<Point2<Fp>> replacements = makeRandomPoints<Fp>(1000, 3333);
+      bool isRemoved = true;
+      for (std::size_t i = 0; i < replacements.size(); ++i)
+      {
+         Point2<Fp>& pt = points[(7 * i) % points.size()];
+         isRemoved = isRemoved && mesh.remove(pt);
+         pt = replacements[i];
+         mesh.insert(pt);
+      }
+
+      VERIFY(isRemoved, caseLabel);
+      VERIFY(mesh.numVertices() == 100, caseLabel);
+      VERIFY(mesh.indexedTriangles(false).vertices.size() == 100, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyMesh::remove forgets constrained edges of the vertex";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(4);
+      const auto a = mesh.insert({0.0, 0.0});
+      const auto b = mesh.insert({4.0, 0.0});
+      mesh.insert({2.0, 3.0});
+      mesh.insertSegment(a, b);
+      mesh.remove({4.0, 0.0});
+      const auto c = mesh.insert({4.0, -1.0});
+
+      VERIFY(c == b, caseLabel);
+      VERIFY(hasEdge(mesh, a, c) || hasEdge(mesh, c, a), caseLabel);
+      VERIFY(!mesh.isConstrained(a, c), caseLabel);
+   }
+}
+
+
+void testLocate()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::locate";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(100);
+      for (const auto& pt : makeRandomPoints<Fp>(100, 2222))
+         mesh.insert(pt);
+
+      // Query points inside and outside of the hull.
+      for (const auto& pt : makeRandomPoints<Fp>(40, 2222, -50.0, 150.0))
+      {
+         // Offset the points to not hit the vertices.
+         const Point2<Fp> queryPt = pt.offset(0.5, 0.5);
+         const auto idx =
+            mesh.locate(queryPt, static_cast<std::uint32_t>(mesh.numTriangleSlots() - 1));
+         VERIFY(!mesh.isRemoved(idx), caseLabel);
+
+         const auto& t = mesh.triangle(idx);
+         if (mesh.isGhost(idx))
+         {
+            // The query point has to be outside of the ghost triangle's hull
+            // edge.
+            std::size_t g = 0;
+            while (t.vertices[g] != Mesh<Fp>::GhostVertex)
+               ++g;
+            VERIFY(orient2d(mesh.vertex(t.vertices[(g + 1) % 3]),
+                            mesh.vertex(t.vertices[(g + 2) % 3]), queryPt) > 0,
+                   caseLabel);
+            continue;
+         }
+
+         const Triangle<Fp> located{mesh.vertex(t.vertices[0]),
+                                    mesh.vertex(t.vertices[1]),
+                                    mesh.vertex(t.vertices[2])};
+         // Check that the query point is inside the located triangle. The
+         // sub-triangles formed with the query point have to cover the located
+         // triangle exactly.
+         const Fp subArea = Triangle<Fp>{queryPt, located[0], located[1]}.area() +
+                            Triangle<Fp>{queryPt, located[1], located[2]}.area() +
+                            Triangle<Fp>{queryPt, located[2], located[0]}.area();
+         VERIFY(fpEqual(subArea, located.area(), 0.0001), caseLabel);
+      }
+   }
+}
+
+
+void testMove()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::move for point inside its star";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      const auto vertex = mesh.insert({2.0, 1.0});
+
+      VERIFY(mesh.move(vertex, {2.5, 2.0}), caseLabel);
+      VERIFY(mesh.vertex(vertex) == Point2<Fp>(2.5, 2.0), caseLabel);
+      VERIFY(mesh.triangles().size() == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+      if constexpr (DelauneyStatsEnabled)
+         VERIFY(mesh.stats().numReinsertedPoints == 0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move for point leaving its star";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(6);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      mesh.insert({1.0, 1.0});
+      const auto vertex = mesh.insert({3.0, 3.0});
+
+      VERIFY(mesh.move(vertex, {0.5, 0.6}), caseLabel);
+      VERIFY(mesh.vertex(vertex) == Point2<Fp>(0.5, 0.6), caseLabel);
+      VERIFY(mesh.triangles().size() == 6, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+      if constexpr (DelauneyStatsEnabled)
+         VERIFY(mesh.stats().numReinsertedPoints == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move for hull point";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      const auto corner = mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      mesh.insert({2.0, 1.0});
+
+      // Moving outwards keeps the hull convex.
+      VERIFY(mesh.move(corner, {5.0, 5.0}), caseLabel);
+      VERIFY(mesh.triangles().size() == 4, caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+
+      // Moving inwards turns the corner into an interior point.
+      VERIFY(mesh.move(corner, {1.5, 2.0}), caseLabel);
+      VERIFY(mesh.triangles().size() == 5, caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 3, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+
+      // Moving outside of the hull turns it into a hull point again.
+      VERIFY(mesh.move(corner, {10.0, 1.0}), caseLabel);
+      VERIFY(countGhostTriangles(mesh) == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move onto other vertex";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      const auto vertex = mesh.insert({2.0, 1.0});
+
+      VERIFY(!mesh.move(vertex, {4.0, 4.0}), caseLabel);
+      VERIFY(mesh.vertex(vertex) == Point2<Fp>(2.0, 1.0), caseLabel);
+      VERIFY(mesh.triangles().size() == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move for removed vertex";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      mesh.insert({0.0, 0.0});
+      mesh.insert({4.0, 0.0});
+      mesh.insert({4.0, 4.0});
+      mesh.insert({0.0, 4.0});
+      const auto vertex = mesh.insert({2.0, 1.0});
+      mesh.remove({2.0, 1.0});
+
+      VERIFY(!mesh.move(vertex, {2.0, 2.0}), caseLabel);
+      VERIFY(mesh.triangles().size() == 2, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move for collinear points";
+
+      using Fp = float;
+
+      Mesh<Fp> mesh;
+      mesh.init(3);
+      mesh.insert({0.0f, 0.0f});
+      mesh.insert({1.0f, 1.0f});
+      const auto vertex = mesh.insert({2.0f, 2.0f});
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+
+      // Moving off the line creates the first triangle.
+      VERIFY(mesh.move(vertex, {2.0f, 0.0f}), caseLabel);
+      VERIFY(mesh.triangles().size() == 1, caseLabel);
+
+      // Moving back onto the line discards it.
+      VERIFY(mesh.move(vertex, {3.0f, 3.0f}), caseLabel);
+      VERIFY(!mesh.hasTriangles(), caseLabel);
+      VERIFY(!mesh.move(vertex, {1.0f, 1.0f}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move for small random displacements";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(300, 2222);
+      Mesh<Fp> mesh;
+      mesh.init(points.size());
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      Random<Fp> rand{-0.5, 0.5, 3333};
+      for (std::size_t round = 0; round < 5; ++round)
+      {
+         for (typename Mesh<Fp>::VertexIdx v = 0; v < points.size(); ++v)
+         {
+            const Fp dx = rand.next();
+            points[v] = mesh.vertex(v) + Vec2<Fp>{dx, rand.next()};
+            VERIFY(mesh.move(v, points[v]), caseLabel);
+         }
+         VERIFY(areNeighborsConsistent(mesh), caseLabel);
+         VERIFY(isDelauney(mesh), caseLabel);
+
+         Mesh<Fp> rebuilt;
+         rebuilt.init(points.size());
+         for (const auto& pt : points)
+            rebuilt.insert(pt);
+         VERIFY(mesh.triangles().size() == rebuilt.triangles().size(), caseLabel);
+      }
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         VERIFY(mesh.stats().numFlips > 0, caseLabel);
+         VERIFY(mesh.stats().numReinsertedPoints < points.size(), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::move for large random displacements";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(200, 2222);
+      const std::vector<Point2<Fp>> targets = makeRandomPoints<Fp>(400, 2222);
+      Mesh<Fp> mesh;
+      mesh.init(points.size());
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      for (typename Mesh<Fp>::VertexIdx v = 0; v < points.size(); ++v)
+         VERIFY(mesh.move(v, targets[200 + v]), caseLabel);
+
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+      VERIFY(mesh.triangles().size() + countGhostTriangles(mesh) ==
+                2 * points.size() - 2,
+             caseLabel);
+   }
+}
+
+
+void testMoveAll()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::moveAll for small displacements";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(300, 2222);
+      Mesh<Fp> mesh;
+      mesh.init(points.size());
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      Random<Fp> rand{-0.3, 0.3, 4444};
+      for (std::size_t round = 0; round < 5; ++round)
+      {
+         for (auto& pt : points)
+         {
+            const Fp dx = rand.next();
+            pt = pt + Vec2<Fp>{dx, rand.next()};
+         }
+         VERIFY(mesh.moveAll(points) == 0, caseLabel);
+         VERIFY(areNeighborsConsistent(mesh), caseLabel);
+         VERIFY(isDelauney(mesh), caseLabel);
+         VERIFY(mesh.vertex(123) == points[123], caseLabel);
+
+         Mesh<Fp> rebuilt;
+         rebuilt.init(points.size());
+         for (const auto& pt : points)
+            rebuilt.insert(pt);
+         VERIFY(mesh.triangles().size() == rebuilt.triangles().size(), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::moveAll for large displacements";
+
+      using Fp = float;
+
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(200, 2222);
+      Mesh<Fp> mesh;
+      mesh.init(points.size());
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      // Mirror the points. All triangles become cw.
+      std::vector<Point2<Fp>> mirrored;
+      for (const auto& pt : points)
+         mirrored.emplace_back(100.0f - pt.x(), pt.y());
+
+      VERIFY(mesh.moveAll(mirrored) == 0, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+      VERIFY(mesh.vertex(10) == mirrored[10], caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::moveAll for collision";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{
+         {0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0}, {0.0, 4.0}, {2.0, 1.0}};
+      Mesh<Fp> mesh;
+      mesh.init(points.size());
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      std::vector<Point2<Fp>> moved = points;
+      moved[4] = {4.0, 4.0};
+      moved[2] = {5.0, 5.0};
+
+      // Vertex 4 can take the previous position of vertex 2 because vertex 2
+      // leaves it.
+      VERIFY(mesh.moveAll(moved) == 0, caseLabel);
+      VERIFY(mesh.vertex(4) == Point2<Fp>(4.0, 4.0), caseLabel);
+
+      moved[0] = {4.0, 4.0};
+      VERIFY(mesh.moveAll(moved) == 1, caseLabel);
+      VERIFY(mesh.vertex(0) == Point2<Fp>(0.0, 0.0), caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(isDelauney(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::moveAll for collinear points";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}};
+      Mesh<Fp> mesh;
+      mesh.init(points.size());
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      VERIFY(mesh.moveAll({{0.0, 0.0}, {1.0, 1.0}, {2.0, 0.0}}) == 0, caseLabel);
+      VERIFY(mesh.triangles().size() == 1, caseLabel);
+   }
+}
+
+
+void testInsertSegment()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::insertSegment across triangles";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(100);
+      for (const auto& pt : makeGridPoints<Fp>(10))
+         mesh.insert(pt);
+      const auto a = mesh.vertexAt({0.0, 0.0});
+      const auto b = mesh.vertexAt({9.0, 4.0});
+
+      VERIFY(mesh.insertSegment(a, b), caseLabel);
+      VERIFY(mesh.isConstrained(a, b), caseLabel);
+      VERIFY(mesh.isConstrained(b, a), caseLabel);
+      VERIFY(hasEdge(mesh, a, b), caseLabel);
+      VERIFY(hasEdge(mesh, b, a), caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+      VERIFY(mesh.triangles().size() == 162, caseLabel);
+      VERIFY(mesh.numVertices() == 100, caseLabel);
+
+      // Later insertions keep the edge.
+      for (const auto& pt : makeRandomPoints<Fp>(200, 2222, 0.0, 9.0))
+         mesh.insert(pt);
+      VERIFY(hasEdge(mesh, a, b), caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insertSegment through vertices";
+
+      using Fp = float;
+
+      Mesh<Fp> mesh;
+      mesh.init(25);
+      for (const auto& pt : makeGridPoints<Fp>(5))
+         mesh.insert(pt);
+
+      VERIFY(mesh.insertSegment(mesh.vertexAt({0.0f, 0.0f}), mesh.vertexAt({4.0f, 2.0f})),
+             caseLabel);
+      // The vertex on the segment splits it.
+      const auto a = mesh.vertexAt({0.0f, 0.0f});
+      const auto mid = mesh.vertexAt({2.0f, 1.0f});
+      const auto b = mesh.vertexAt({4.0f, 2.0f});
+      VERIFY(mesh.isConstrained(a, mid), caseLabel);
+      VERIFY(mesh.isConstrained(mid, b), caseLabel);
+      VERIFY(!mesh.isConstrained(a, b), caseLabel);
+      VERIFY(hasEdge(mesh, a, mid), caseLabel);
+      VERIFY(hasEdge(mesh, mid, b), caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insertSegment for crossing segments";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(200);
+      for (const auto& pt : makeRandomPoints<Fp>(200, 2222))
+         mesh.insert(pt);
+      const std::vector<Point2<Fp>> corners{
+         {10.0, 10.0}, {90.0, 90.0}, {10.0, 90.0}, {90.0, 10.0}};
+      for (const auto& pt : corners)
+         mesh.insert(pt);
+      const std::size_t numVertices = mesh.numVertices();
+
+      VERIFY(mesh.insertSegment(mesh.vertexAt(corners[0]), mesh.vertexAt(corners[1])),
+             caseLabel);
+      VERIFY(mesh.insertSegment(mesh.vertexAt(corners[2]), mesh.vertexAt(corners[3])),
+             caseLabel);
+
+      // Both segments are split at their intersection.
+      VERIFY(mesh.numVertices() == numVertices + 1, caseLabel);
+      const auto center = mesh.vertexAt({50.0, 50.0});
+      VERIFY(center != Mesh<Fp>::NoIdx, caseLabel);
+      for (const auto& pt : corners)
+         VERIFY(mesh.isConstrained(mesh.vertexAt(pt), center), caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insert on constrained edge";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(5);
+      for (const auto& pt : std::vector<Point2<Fp>>{
+              {0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0}, {0.0, 4.0}})
+         mesh.insert(pt);
+      const auto a = mesh.vertexAt({0.0, 0.0});
+      const auto b = mesh.vertexAt({4.0, 4.0});
+      VERIFY(mesh.insertSegment(a, b), caseLabel);
+
+      const auto mid = mesh.insert({2.0, 2.0});
+      VERIFY(!mesh.isConstrained(a, b), caseLabel);
+      VERIFY(mesh.isConstrained(a, mid), caseLabel);
+      VERIFY(mesh.isConstrained(mid, b), caseLabel);
+      VERIFY(mesh.triangles().size() == 4, caseLabel);
+      VERIFY(areNeighborsConsistent(mesh), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::insertSegment without triangles";
+
+      using Fp = double;
+
+      Mesh<Fp> mesh;
+      mesh.init(2);
+      const auto a = mesh.insert({0.0, 0.0});
+      const auto b = mesh.insert({1.0, 0.0});
+
+      VERIFY(!mesh.insertSegment(a, b), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDelauneyMesh()
+{
+   testInit();
+   testInsert();
+   testRemove();
+   testLocate();
+   testMove();
+   testMoveAll();
+   testInsertSegment();
+}
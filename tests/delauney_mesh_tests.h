@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for the Delauney triangulation mesh.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDelauneyMesh();
@@ -0,0 +1,262 @@
+//
+// geomcpp tests
+// Tests for point location queries on Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_point_locator_tests.h"
+#include "delauney_point_locator.h"
+#include "delauney_triangulation.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include "test_util.h"
+#include <future>
+#include <string>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+template <typename T> using Locator = DelauneyPointLocator<T>;
+
+
+template <typename T> IndexedTriangulation<T> makeTriangulation(bool withNeighbors)
+{
+   return DelauneyTriangulation<T>{makeRandomPoints<T>(1000, 1111)}
+      .triangulateIndexed(withNeighbors);
+}
+
+
+template <typename T>
+bool isInTriangle(const IndexedTriangulation<T>& triangulation, std::size_t idx,
+                  const Point2<T>& pt)
+{
+   const auto vertex = [&](std::size_t pos) {
+      return triangulation.vertices[triangulation.indices[3 * idx + pos]];
+   };
+   return orient2d(vertex(0), vertex(1), pt) >= 0 &&
+          orient2d(vertex(1), vertex(2), pt) >= 0 &&
+          orient2d(vertex(2), vertex(0), pt) >= 0;
+}
+
+
+template <typename T>
+bool isInAnyTriangle(const IndexedTriangulation<T>& triangulation, const Point2<T>& pt)
+{
+   for (std::size_t i = 0; i < triangulation.numTriangles(); ++i)
+      if (isInTriangle(triangulation, i, pt))
+         return true;
+   return false;
+}
+
+
+template <typename T>
+T distSquared(const Point2<T>& a, const Point2<T>& b)
+{
+   const T dx = a.x() - b.x();
+   const T dy = a.y() - b.y();
+   return dx * dx + dy * dy;
+}
+
+
+// Checks that a given vertex is as close to a given point as any other vertex.
+template <typename T>
+bool isNearestVertex(const IndexedTriangulation<T>& triangulation,
+                     typename Locator<T>::Idx idx, const Point2<T>& pt)
+{
+   const T dist = distSquared(triangulation.vertices[idx], pt);
+   for (const auto& v : triangulation.vertices)
+      if (distSquared(v, pt) < dist)
+         return false;
+   return true;
+}
+
+
+///////////////////
+
+void testLocate()
+{
+   {
+      const std::string caseLabel = "DelauneyPointLocator::locate";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+      const auto& triangulation = locator.triangulation();
+
+      // Query points inside and outside of the triangulation.
+      bool isCorrect = true;
+      for (const auto& pt : makeRandomPoints<Fp>(500, 2222, -20.0, 120.0))
+      {
+         const auto idx = locator.locate(pt);
+         if (idx == Locator<Fp>::NoIdx)
+            isCorrect = isCorrect && !isInAnyTriangle(triangulation, pt);
+         else
+            isCorrect = isCorrect && isInTriangle(triangulation, idx, pt);
+      }
+      VERIFY(isCorrect, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyPointLocator::locate for vertices";
+
+      using Fp = float;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+      const auto& triangulation = locator.triangulation();
+
+      bool isCorrect = true;
+      for (const auto& pt : triangulation.vertices)
+      {
+         const auto idx = locator.locate(pt);
+         isCorrect = isCorrect && idx != Locator<Fp>::NoIdx &&
+                     isInTriangle(triangulation, idx, pt);
+      }
+      VERIFY(isCorrect, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyPointLocator::locate without neighbors";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(false)};
+      const IndexedTriangulation<Fp> expected = makeTriangulation<Fp>(true);
+
+      VERIFY(locator.triangulation().neighbors == expected.neighbors, caseLabel);
+      VERIFY(locator.locate({50.0, 50.0}) != Locator<Fp>::NoIdx, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyPointLocator::locate for empty triangulation";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{IndexedTriangulation<Fp>{}};
+
+      VERIFY(locator.locate({1.0, 1.0}) == Locator<Fp>::NoIdx, caseLabel);
+      VERIFY(locator.nearestVertex({1.0, 1.0}) == Locator<Fp>::NoIdx, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyPointLocator::locate for batch";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+      const std::vector<Point2<Fp>> points =
+         makeRandomPoints<Fp>(500, 3333, -20.0, 120.0);
+
+      std::vector<Locator<Fp>::Idx> result;
+      locator.locate(points, result);
+
+      bool isCorrect = result.size() == points.size();
+      for (std::size_t i = 0; i < points.size() && isCorrect; ++i)
+      {
+         if (result[i] == Locator<Fp>::NoIdx)
+            isCorrect = locator.locate(points[i]) == Locator<Fp>::NoIdx;
+         else
+            isCorrect = isInTriangle(locator.triangulation(), result[i], points[i]);
+      }
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+
+void testNearestVertex()
+{
+   {
+      const std::string caseLabel = "DelauneyPointLocator::nearestVertex";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+
+      bool isCorrect = true;
+      for (const auto& pt : makeRandomPoints<Fp>(500, 4444, -50.0, 150.0))
+         isCorrect = isCorrect && isNearestVertex(locator.triangulation(),
+                                                  locator.nearestVertex(pt), pt);
+      VERIFY(isCorrect, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyPointLocator::nearestVertex for batch";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+      const std::vector<Point2<Fp>> points =
+         makeRandomPoints<Fp>(500, 5555, -50.0, 150.0);
+
+      std::vector<Locator<Fp>::Idx> result;
+      locator.nearestVertex(points, result);
+
+      bool isCorrect = result.size() == points.size();
+      for (std::size_t i = 0; i < points.size() && isCorrect; ++i)
+         isCorrect = isNearestVertex(locator.triangulation(), result[i], points[i]);
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+
+void testConcurrentQueries()
+{
+   {
+      const std::string caseLabel = "DelauneyPointLocator concurrent queries";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+      const std::vector<Point2<Fp>> points =
+         makeRandomPoints<Fp>(2000, 6666, -20.0, 120.0);
+
+      std::vector<Locator<Fp>::Idx> expected;
+      locator.nearestVertex(points, expected);
+
+      std::vector<std::future<std::vector<Locator<Fp>::Idx>>> results;
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         results.push_back(std::async(std::launch::async, [&locator, &points]() {
+            std::vector<Locator<Fp>::Idx> result;
+            for (const auto& pt : points)
+               result.push_back(locator.nearestVertex(pt));
+            return result;
+         }));
+      }
+
+      bool isCorrect = true;
+      for (auto& result : results)
+         isCorrect = isCorrect && result.get() == expected;
+      VERIFY(isCorrect, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyPointLocator batch with multiple threads";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{makeTriangulation<Fp>(true)};
+      const std::vector<Point2<Fp>> points =
+         makeRandomPoints<Fp>(50000, 7777, -20.0, 120.0);
+
+      std::vector<Locator<Fp>::Idx> serial;
+      std::vector<Locator<Fp>::Idx> parallel;
+      locator.locate(points, serial, 1);
+      locator.locate(points, parallel, 4);
+      VERIFY(parallel == serial, caseLabel);
+
+      locator.nearestVertex(points, serial, 1);
+      locator.nearestVertex(points, parallel, 3);
+      VERIFY(parallel == serial, caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDelauneyPointLocator()
+{
+   testLocate();
+   testNearestVertex();
+   testConcurrentQueries();
+}
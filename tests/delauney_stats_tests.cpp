@@ -0,0 +1,277 @@
+//
+// geomcpp tests
+// Tests for Delauney triangulation statistics.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_stats_tests.h"
+#include "delauney_mesh.h"
+#include "delauney_stats.h"
+#include "delauney_triangulation.h"
+#include "delauney_workspace.h"
+#include "point2.h"
+#include "test_util.h"
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+bool isEmpty(const DelauneyHistogram& hist)
+{
+   for (const std::size_t count : hist.buckets)
+      if (count != 0)
+         return false;
+   return hist.numValues == 0 && hist.sum == 0 && hist.max == 0;
+}
+
+
+bool isEmpty(const DelauneyStats& stats)
+{
+   return stats.sortSeconds == 0.0 && stats.locateSeconds == 0.0 &&
+          stats.findCavitySeconds == 0.0 && stats.fillCavitySeconds == 0.0 &&
+          stats.outputSeconds == 0.0 && stats.numInsertedPoints == 0 &&
+          stats.numDuplicatePoints == 0 && stats.numPendingPoints == 0 &&
+          isEmpty(stats.walkLengths) && isEmpty(stats.cavitySizes) &&
+          isEmpty(stats.boundarySizes) && stats.numVertexAllocations == 0 &&
+          stats.numTriangleAllocations == 0 && stats.numFlips == 0 &&
+          stats.numReinsertedPoints == 0;
+}
+
+
+///////////////////
+
+void testHistogram()
+{
+   {
+      const std::string caseLabel = "DelauneyHistogram::add";
+
+      DelauneyHistogram hist;
+      for (const std::size_t value : {0, 1, 2, 3, 4, 7, 8, 100})
+         hist.add(value);
+
+      VERIFY(hist.buckets[0] == 2, caseLabel);
+      VERIFY(hist.buckets[1] == 2, caseLabel);
+      VERIFY(hist.buckets[2] == 2, caseLabel);
+      VERIFY(hist.buckets[3] == 1, caseLabel);
+      VERIFY(hist.buckets[6] == 1, caseLabel);
+      VERIFY(hist.numValues == 8, caseLabel);
+      VERIFY(hist.sum == 125, caseLabel);
+      VERIFY(hist.max == 100, caseLabel);
+      VERIFY(hist.mean() == 125.0 / 8.0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyHistogram::add for values beyond last bucket";
+
+      DelauneyHistogram hist;
+      hist.add(std::size_t(1) << 40);
+
+      VERIFY(hist.buckets[DelauneyHistogram::NumBuckets - 1] == 1, caseLabel);
+      VERIFY(hist.max == std::size_t(1) << 40, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyHistogram::mean for empty histogram";
+
+      VERIFY(DelauneyHistogram{}.mean() == 0.0, caseLabel);
+   }
+}
+
+
+void testScopedStatsTimer()
+{
+   {
+      const std::string caseLabel = "ScopedStatsTimer when enabled";
+
+      double seconds = 1.0;
+      {
+         internals::ScopedStatsTimer<true> timer{seconds};
+         std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+      VERIFY(seconds >= 1.001, caseLabel);
+   }
+   {
+      const std::string caseLabel = "ScopedStatsTimer when disabled";
+
+      double seconds = 1.0;
+      {
+         internals::ScopedStatsTimer<false> timer{seconds};
+         std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+      VERIFY(seconds == 1.0, caseLabel);
+   }
+}
+
+
+void testTriangulationStats()
+{
+   {
+      const std::string caseLabel = "DelauneyTriangulation::stats";
+
+      using Fp = double;
+
+      const std::size_t n = 1000;
+      DelauneyTriangulation<Fp> delauney{makeRandomPoints<Fp>(n, 1234)};
+      delauney.triangulate();
+      const DelauneyStats& stats = delauney.stats();
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         VERIFY(stats.numInsertedPoints == n, caseLabel);
+         VERIFY(stats.numDuplicatePoints == 0, caseLabel);
+         VERIFY(stats.numPendingPoints == 2, caseLabel);
+         // Each point after the first triangle is located and replaces a cavity.
+         VERIFY(stats.walkLengths.numValues == n - 3, caseLabel);
+         VERIFY(stats.cavitySizes.numValues == n - 3, caseLabel);
+         VERIFY(stats.boundarySizes.numValues == n - 3, caseLabel);
+         // Including ghost triangles, each insertion adds two triangles.
+         VERIFY(stats.boundarySizes.sum == stats.cavitySizes.sum + 2 * (n - 3),
+                caseLabel);
+         VERIFY(stats.cavitySizes.max >= 1, caseLabel);
+         VERIFY(stats.walkLengths.max >= 1, caseLabel);
+         // The mesh reserves memory for all samples.
+         VERIFY(stats.numVertexAllocations == 0, caseLabel);
+         VERIFY(stats.locateSeconds > 0.0, caseLabel);
+         VERIFY(stats.findCavitySeconds > 0.0, caseLabel);
+         VERIFY(stats.fillCavitySeconds > 0.0, caseLabel);
+         VERIFY(stats.outputSeconds > 0.0, caseLabel);
+         VERIFY(stats.sortSeconds >= 0.0, caseLabel);
+      }
+      else
+      {
+         VERIFY(isEmpty(stats), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "DelauneyTriangulation::stats for duplicate points";
+
+      using Fp = float;
+
+      std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(100, 2345);
+      points.push_back(points[0]);
+      points.push_back(points[50]);
+      DelauneyTriangulation<Fp> delauney{points};
+      delauney.triangulateIndexed();
+      const DelauneyStats& stats = delauney.stats();
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         VERIFY(stats.numInsertedPoints == 100, caseLabel);
+         VERIFY(stats.numDuplicatePoints == 2, caseLabel);
+         VERIFY(stats.outputSeconds > 0.0, caseLabel);
+      }
+      else
+      {
+         VERIFY(isEmpty(stats), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "DelauneyTriangulation::stats for divide-and-conquer";
+
+      using Fp = double;
+
+      DelauneyTriangulation<Fp> delauney{makeRandomPoints<Fp>(100, 3456),
+                                         DelauneyAlgorithm::DivideAndConquer};
+      delauney.triangulate();
+
+      VERIFY(isEmpty(delauney.stats()), caseLabel);
+   }
+}
+
+
+void testMeshStats()
+{
+   {
+      const std::string caseLabel = "DelauneyMesh::stats for allocations";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(500, 4567);
+
+      // Without reserved memory the buffers have to grow.
+      internals::DelauneyMesh<Fp> mesh;
+      mesh.init(0);
+      for (const auto& pt : points)
+         mesh.insert(pt);
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         VERIFY(mesh.stats().numVertexAllocations > 0, caseLabel);
+         VERIFY(mesh.stats().numTriangleAllocations > 0, caseLabel);
+      }
+      else
+      {
+         VERIFY(isEmpty(mesh.stats()), caseLabel);
+      }
+
+      // Initializing discards the statistics.
+      mesh.init(points.size());
+      VERIFY(isEmpty(mesh.stats()), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyMesh::stats for collinear points";
+
+      using Fp = float;
+
+      internals::DelauneyMesh<Fp> mesh;
+      mesh.init(3);
+      for (const Point2<Fp>& pt : {Point2<Fp>{0.0f, 0.0f}, Point2<Fp>{1.0f, 1.0f},
+                                   Point2<Fp>{2.0f, 2.0f}, Point2<Fp>{1.0f, 1.0f}})
+         mesh.insert(pt);
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         VERIFY(mesh.stats().numInsertedPoints == 3, caseLabel);
+         VERIFY(mesh.stats().numPendingPoints == 3, caseLabel);
+         VERIFY(mesh.stats().numDuplicatePoints == 1, caseLabel);
+         VERIFY(mesh.stats().cavitySizes.numValues == 0, caseLabel);
+      }
+      else
+      {
+         VERIFY(isEmpty(mesh.stats()), caseLabel);
+      }
+   }
+}
+
+
+void testWorkspaceStats()
+{
+   {
+      const std::string caseLabel = "DelauneyWorkspace::stats";
+
+      using Fp = double;
+
+      DelauneyWorkspace<Fp> workspace;
+      workspace.triangulate(makeRandomPoints<Fp>(300, 5678));
+      workspace.triangulate(makeRandomPoints<Fp>(100, 6789));
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         // Only the last triangulation is recorded.
+         VERIFY(workspace.stats().numInsertedPoints == 100, caseLabel);
+         VERIFY(workspace.stats().cavitySizes.numValues == 97, caseLabel);
+      }
+      else
+      {
+         VERIFY(isEmpty(workspace.stats()), caseLabel);
+      }
+   }
+}
+
+} // namespace
+
+
+void testDelauneyStats()
+{
+   testHistogram();
+   testScopedStatsTimer();
+   testTriangulationStats();
+   testMeshStats();
+   testWorkspaceStats();
+}
@@ -7,9 +7,15 @@
 //
 #include "delauney_triangulation_tests.h"
 #include "delauney_triangulation.h"
+#include "indexed_triangulation.h"
 #include "point2.h"
+#include "predicates.h"
 #include "test_util.h"
 #include "essentutils/fputil.h"
+#include "essentutils/rand_util.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 using namespace geom;
@@ -20,15 +26,29 @@ namespace
 {
 ///////////////////
 
-void testTriangulateWithNoPoints()
+std::string algorithmLabel(DelauneyAlgorithm algorithm)
 {
+   switch (algorithm)
    {
-      const std::string caseLabel = "Delauney triangulation with no points";
+   case DelauneyAlgorithm::BowyerWatson:
+      return " (Bowyer-Watson)";
+   case DelauneyAlgorithm::DivideAndConquer:
+      return " (divide-and-conquer)";
+   }
+   return "";
+}
+
+
+void testTriangulateWithNoPoints(DelauneyAlgorithm algorithm)
+{
+   {
+      const std::string caseLabel =
+         "Delauney triangulation with no points" + algorithmLabel(algorithm);
 
       using Fp = float;
 
       const std::vector<Point2<Fp>> noSamples;
-      DelauneyTriangulation<Fp> dt{noSamples};
+      DelauneyTriangulation<Fp> dt{noSamples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
 
       VERIFY(triangles.empty(), caseLabel);
@@ -36,15 +56,16 @@ void testTriangulateWithNoPoints()
 }
 
 
-void testTriangulateWithOnePoint()
+void testTriangulateWithOnePoint(DelauneyAlgorithm algorithm)
 {
    {
-      const std::string caseLabel = "Delauney triangulation with one point";
+      const std::string caseLabel =
+         "Delauney triangulation with one point" + algorithmLabel(algorithm);
 
       using Fp = float;
 
       const std::vector<Point2<Fp>> samples{Point2<Fp>{1.0, 2.0}};
-      DelauneyTriangulation<Fp> dt{samples};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
 
       VERIFY(triangles.empty(), caseLabel);
@@ -52,15 +73,16 @@ void testTriangulateWithOnePoint()
 }
 
 
-void testTriangulateWithTwoPoints()
+void testTriangulateWithTwoPoints(DelauneyAlgorithm algorithm)
 {
    {
-      const std::string caseLabel = "Delauney triangulation with two points";
+      const std::string caseLabel =
+         "Delauney triangulation with two points" + algorithmLabel(algorithm);
 
       using Fp = double;
 
       const std::vector<Point2<Fp>> samples{Point2<Fp>{1.0, 2.0}, Point2<Fp>{6.0, -3.0}};
-      DelauneyTriangulation<Fp> dt{samples};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
 
       VERIFY(triangles.empty(), caseLabel);
@@ -68,10 +90,11 @@ void testTriangulateWithTwoPoints()
 }
 
 
-void testTriangulateWithThreePoints()
+void testTriangulateWithThreePoints(DelauneyAlgorithm algorithm)
 {
    {
-      const std::string caseLabel = "Delauney triangulation with three points";
+      const std::string caseLabel =
+         "Delauney triangulation with three points" + algorithmLabel(algorithm);
 
       using Fp = double;
 
@@ -79,7 +102,7 @@ void testTriangulateWithThreePoints()
       const Point2<Fp> b{6.0, -3.0};
       const Point2<Fp> c{-2.0, -1.0};
       const std::vector<Point2<Fp>> samples{a, b, c};
-      DelauneyTriangulation<Fp> dt{samples};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
 
       VERIFY(triangles.size() == 1, caseLabel);
@@ -94,16 +117,17 @@ void testTriangulateWithThreePoints()
 }
 
 
-void testTriangulateWithFourPointsAsRect()
+void testTriangulateWithFourPointsAsRect(DelauneyAlgorithm algorithm)
 {
    {
-      const std::string caseLabel = "Delauney triangulation with four points as rect";
+      const std::string caseLabel =
+         "Delauney triangulation with four points as rect" + algorithmLabel(algorithm);
 
       using Fp = double;
 
       const std::vector<Point2<Fp>> samples{
          {1.0, 10.0}, {5.0, 10.0}, {1.0, 5.0}, {1.0, 1.0}};
-      DelauneyTriangulation<Fp> dt{samples};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
 
       VERIFY(triangles.size() == 2, caseLabel);
@@ -113,35 +137,229 @@ void testTriangulateWithFourPointsAsRect()
 }
 
 
-void testTriangulateWithTenPoints()
+void testTriangulateWithTenPoints(DelauneyAlgorithm algorithm)
 {
    {
-      const std::string caseLabel = "Delauney triangulation with ten points";
+      const std::string caseLabel =
+         "Delauney triangulation with ten points" + algorithmLabel(algorithm);
 
       using Fp = double;
 
       const std::vector<Point2<Fp>> samples{{2.0, 1.0},  {5.0, 2.0}, {2.0, 4.0},
                                             {5.0, 4.0},  {9.0, 5.0}, {5.0, 7.0},
                                             {10.0, 7.0}, {3.0, 8.0}, {1.0, 10.0}};
-      DelauneyTriangulation<Fp> dt{samples};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
+      const std::vector<Triangle<Fp>> triangles = dt.triangulate();
+
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+}
+
+
+void testTriangulateWithManyPoints(DelauneyAlgorithm algorithm)
+{
+   {
+      const std::string caseLabel =
+         "Delauney triangulation with many random points" + algorithmLabel(algorithm);
+
+      using Fp = double;
+
+      Random<Fp> rand{Fp(0), Fp(100), 3333};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 500; ++i)
+      {
+         const Fp x = rand.next();
+         samples.emplace_back(x, rand.next());
+      }
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
+      const std::vector<Triangle<Fp>> triangles = dt.triangulate();
+
+      VERIFY(!triangles.empty(), caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "Delauney triangulation with points on a grid" + algorithmLabel(algorithm);
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> samples;
+      for (int r = 0; r < 10; ++r)
+         for (int c = 0; c < 10; ++c)
+            samples.emplace_back(c * 2.0, r * 2.0);
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
 
+      // Each grid cell is split into two triangles.
+      VERIFY(triangles.size() == 2 * 9 * 9, caseLabel);
       VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
              caseLabel);
    }
 }
 
 
-void testAccessDelauneyTriangles()
+void testTriangulateWithBrioInsertionOrder()
+{
+   {
+      const std::string caseLabel =
+         "Delauney triangulation with many random points in BRIO insertion order";
+
+      using Fp = double;
+
+      Random<Fp> rand{Fp(0), Fp(100), 7777};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 1000; ++i)
+      {
+         const Fp x = rand.next();
+         samples.emplace_back(x, rand.next());
+      }
+      DelauneyTriangulation<Fp> dt{samples, DelauneyAlgorithm::BowyerWatson, 1,
+                                   DelauneyInsertionOrder::Brio};
+      const std::vector<Triangle<Fp>> triangles = dt.triangulate();
+
+      DelauneyTriangulation<Fp> stripsDt{samples};
+      VERIFY(triangles.size() == stripsDt.triangulate().size(), caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "Delauney triangulation with points on a grid in BRIO insertion order";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> samples;
+      for (int r = 0; r < 20; ++r)
+         for (int c = 0; c < 20; ++c)
+            samples.emplace_back(c * 2.0, r * 2.0);
+      DelauneyTriangulation<Fp> dt{samples, DelauneyAlgorithm::BowyerWatson, 1,
+                                   DelauneyInsertionOrder::Brio};
+      const std::vector<Triangle<Fp>> triangles = dt.triangulate();
+
+      VERIFY(triangles.size() == 2 * 19 * 19, caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+}
+
+
+// Checks that the neighbor of each triangle edge shares the edge and references
+// the triangle back.
+template <typename T> bool areNeighborsConsistent(const IndexedTriangulation<T>& indexed)
+{
+   const auto& idx = indexed.indices;
+   const auto& nb = indexed.neighbors;
+   for (std::size_t t = 0; t < indexed.numTriangles(); ++t)
+   {
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         const std::uint32_t n = nb[3 * t + i];
+         if (n == IndexedTriangulation<T>::NoNeighbor)
+            continue;
+
+         const std::uint32_t from = idx[3 * t + (i + 1) % 3];
+         const std::uint32_t to = idx[3 * t + (i + 2) % 3];
+         bool isShared = false;
+         for (std::size_t j = 0; j < 3; ++j)
+         {
+            // The neighbor traverses the shared edge in the opposite direction.
+            if (idx[3 * n + (j + 1) % 3] == to && idx[3 * n + (j + 2) % 3] == from)
+               isShared = nb[3 * n + j] == t;
+         }
+         if (!isShared)
+            return false;
+      }
+   }
+   return true;
+}
+
+
+void testTriangulateIndexed(DelauneyAlgorithm algorithm)
+{
+   {
+      const std::string caseLabel =
+         "Indexed Delauney triangulation with many random points" +
+         algorithmLabel(algorithm);
+
+      using Fp = double;
+
+      Random<Fp> rand{Fp(0), Fp(100), 5555};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 500; ++i)
+      {
+         const Fp x = rand.next();
+         samples.emplace_back(x, rand.next());
+      }
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
+      const IndexedTriangulation<Fp> indexed = dt.triangulateIndexed(true);
+      const std::vector<Triangle<Fp>> triangles = dt.triangulate();
+
+      VERIFY(indexed.numTriangles() == triangles.size(), caseLabel);
+      VERIFY(indexed.vertices.size() <= samples.size(), caseLabel);
+      VERIFY(indexed.neighbors.size() == indexed.indices.size(), caseLabel);
+
+      bool areValid = true;
+      std::vector<Triangle<Fp>> indexedTriangles;
+      for (std::size_t t = 0; t < indexed.numTriangles(); ++t)
+      {
+         const Point2<Fp>& a = indexed.vertices[indexed.indices[3 * t]];
+         const Point2<Fp>& b = indexed.vertices[indexed.indices[3 * t + 1]];
+         const Point2<Fp>& c = indexed.vertices[indexed.indices[3 * t + 2]];
+         areValid = areValid && orient2d(a, b, c) > 0;
+         indexedTriangles.push_back(indexed.triangle(t));
+      }
+      VERIFY(areValid, caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(indexedTriangles),
+             caseLabel);
+      VERIFY(areNeighborsConsistent(indexed), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "Indexed Delauney triangulation of grid points without neighbors" +
+         algorithmLabel(algorithm);
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> samples;
+      for (int r = 0; r < 10; ++r)
+         for (int c = 0; c < 10; ++c)
+            samples.emplace_back(c * 2.0, r * 2.0);
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
+      const IndexedTriangulation<Fp> indexed = dt.triangulateIndexed();
+
+      VERIFY(indexed.numTriangles() == 2 * 9 * 9, caseLabel);
+      VERIFY(indexed.vertices.size() == samples.size(), caseLabel);
+      VERIFY(!indexed.hasNeighbors(), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "Indexed Delauney triangulation with two points" + algorithmLabel(algorithm);
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> samples{Point2<Fp>{1.0, 2.0}, Point2<Fp>{6.0, -3.0}};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
+      const IndexedTriangulation<Fp> indexed = dt.triangulateIndexed(true);
+
+      VERIFY(indexed.numTriangles() == 0, caseLabel);
+      VERIFY(indexed.vertices.empty(), caseLabel);
+   }
+}
+
+
+void testAccessDelauneyTriangles(DelauneyAlgorithm algorithm)
 {
    {
-      const std::string caseLabel = "Access Delauney triangles after triangulation";
+      const std::string caseLabel =
+         "Access Delauney triangles after triangulation" + algorithmLabel(algorithm);
 
       using Fp = double;
 
       const std::vector<Point2<Fp>> samples{
          {2.0, 1.0}, {5.0, 2.0}, {2.0, 4.0}, {5.0, 4.0}, {9.0, 5.0}};
-      DelauneyTriangulation<Fp> dt{samples};
+      DelauneyTriangulation<Fp> dt{samples, algorithm};
       const std::vector<Triangle<Fp>> triangles = dt.triangulate();
       const std::vector<DelauneyTriangle<Fp>> delauneyTriangles = dt.delauneyTriangles();
 
@@ -194,6 +412,50 @@ void testIsDelauneyConditionSatisfied()
       VERIFY(!DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
              caseLabel);
    }
+   {
+      const std::string caseLabel = "DelauneyTriangulation::isDelauneyConditionSatisfied "
+                                    "for cocircular points";
+
+      using Fp = double;
+
+      // The fourth point of each square is on the circumcircle of both triangles.
+      std::vector<Triangle<Fp>> triangles;
+      for (int i = 0; i < 10; ++i)
+      {
+         const Fp x = static_cast<Fp>(i);
+         triangles.emplace_back(Point2<Fp>{x, 0.0}, Point2<Fp>{x + 1.0, 0.0},
+                                Point2<Fp>{x + 1.0, 1.0});
+         triangles.emplace_back(Point2<Fp>{x, 0.0}, Point2<Fp>{x + 1.0, 1.0},
+                                Point2<Fp>{x, 1.0});
+      }
+
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyTriangulation::isDelauneyConditionSatisfied "
+                                    "for violation in the last of many triangles";
+
+      using Fp = float;
+
+      std::vector<Triangle<Fp>> triangles;
+      for (int i = 0; i < 100; ++i)
+      {
+         const Fp x = static_cast<Fp>(i);
+         triangles.emplace_back(Point2<Fp>{x, 0.0f}, Point2<Fp>{x + 1.0f, 0.0f},
+                                Point2<Fp>{x + 1.0f, 1.0f});
+         triangles.emplace_back(Point2<Fp>{x, 0.0f}, Point2<Fp>{x + 1.0f, 1.0f},
+                                Point2<Fp>{x, 1.0f});
+      }
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+
+      // Flat triangle whose circumcircle contains vertices of the squares.
+      triangles.emplace_back(Point2<Fp>{50.0f, 1.0f}, Point2<Fp>{60.0f, 1.0f},
+                             Point2<Fp>{55.0f, 1.1f});
+      VERIFY(!DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
 }
 
 } // namespace
@@ -201,12 +463,19 @@ void testIsDelauneyConditionSatisfied()
 
 void testDelauneyTriangulation()
 {
-   testTriangulateWithNoPoints();
-   testTriangulateWithOnePoint();
-   testTriangulateWithTwoPoints();
-   testTriangulateWithThreePoints();
-   testTriangulateWithFourPointsAsRect();
-   testTriangulateWithTenPoints();
-   testAccessDelauneyTriangles();
+   for (DelauneyAlgorithm algorithm :
+        {DelauneyAlgorithm::BowyerWatson, DelauneyAlgorithm::DivideAndConquer})
+   {
+      testTriangulateWithNoPoints(algorithm);
+      testTriangulateWithOnePoint(algorithm);
+      testTriangulateWithTwoPoints(algorithm);
+      testTriangulateWithThreePoints(algorithm);
+      testTriangulateWithFourPointsAsRect(algorithm);
+      testTriangulateWithTenPoints(algorithm);
+      testTriangulateWithManyPoints(algorithm);
+      testTriangulateIndexed(algorithm);
+      testAccessDelauneyTriangles(algorithm);
+   }
+   testTriangulateWithBrioInsertionOrder();
    testIsDelauneyConditionSatisfied();
 }
@@ -0,0 +1,184 @@
+//
+// geomcpp tests
+// Tests for validation of Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_validation_tests.h"
+#include "delauney_triangulation.h"
+#include "delauney_validation.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "predicates.h"
+#include "test_util.h"
+#include "triangle.h"
+#include <string>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+// Flips the edge between a triangle and its neighbor across the edge opposite
+// of its first vertex if the two triangles form a convex quadrilateral. The
+// flipped triangles violate the Delauney condition. Returns false if the edge
+// cannot be flipped.
+template <typename T>
+bool flipEdge(IndexedTriangulation<T>& triangulation, std::size_t idx)
+{
+   std::vector<std::uint32_t>& indices = triangulation.indices;
+   const std::uint32_t neighbor = triangulation.neighbors[3 * idx];
+   if (neighbor == IndexedTriangulation<T>::NoNeighbor)
+      return false;
+
+   const std::uint32_t a = indices[3 * idx];
+   const std::uint32_t b = indices[3 * idx + 1];
+   const std::uint32_t c = indices[3 * idx + 2];
+   std::uint32_t d = 0;
+   for (std::size_t i = 0; i < 3; ++i)
+   {
+      const std::uint32_t v = indices[3 * neighbor + i];
+      if (v != b && v != c)
+         d = v;
+   }
+
+   const auto& vertices = triangulation.vertices;
+   if (orient2d(vertices[a], vertices[b], vertices[d]) <= 0 ||
+       orient2d(vertices[a], vertices[d], vertices[c]) <= 0)
+      return false;
+
+   indices[3 * idx + 2] = d;
+   indices[3 * neighbor] = a;
+   indices[3 * neighbor + 1] = d;
+   indices[3 * neighbor + 2] = c;
+   return true;
+}
+
+
+///////////////////
+
+void testFindViolationsForTriangles()
+{
+   {
+      const std::string caseLabel = "DelauneyValidator::findViolations for no triangles";
+
+      using Fp = double;
+
+      VERIFY(DelauneyValidator<Fp>::findViolations(std::vector<Triangle<Fp>>{}).empty(),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyValidator::findViolations for Delauney triangulation";
+
+      using Fp = double;
+
+      const std::vector<Triangle<Fp>> triangles =
+         DelauneyTriangulation<Fp>{makeRandomPoints<Fp>(2000, 7777, 0.0, 1000.0)}
+            .triangulate();
+
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangles).empty(), caseLabel);
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangles, 4).empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyValidator::findViolations for flipped diagonal";
+
+      using Fp = double;
+
+      // The long diagonal of a flat diamond.
+      const Point2<Fp> a{0.0, 0.0};
+      const Point2<Fp> b{4.0, -1.0};
+      const Point2<Fp> c{8.0, 0.0};
+      const Point2<Fp> d{4.0, 1.0};
+      const std::vector<Triangle<Fp>> triangles{
+         {b, c, d}, {a, b, c}, {a, c, d}, {a, b, d}};
+
+      const std::vector<std::size_t> violations =
+         DelauneyValidator<Fp>::findViolations(triangles);
+      VERIFY(violations == std::vector<std::size_t>({1, 2}), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyValidator::findViolations for degenerate triangle";
+
+      using Fp = float;
+
+      const std::vector<Triangle<Fp>> triangles{
+         {{0.0f, 0.0f}, {2.0f, 0.0f}, {4.0f, 0.0f}},
+         {{0.0f, 0.0f}, {2.0f, 0.0f}, {1.0f, 2.0f}}};
+
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangles).empty(), caseLabel);
+   }
+}
+
+
+void testFindViolationsForIndexedTriangulation()
+{
+   {
+      const std::string caseLabel =
+         "DelauneyValidator::findViolations for indexed Delauney triangulation";
+
+      using Fp = double;
+
+      const IndexedTriangulation<Fp> triangulation =
+         DelauneyTriangulation<Fp>{makeRandomPoints<Fp>(2000, 7777, 0.0, 1000.0)}
+            .triangulateIndexed();
+
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangulation).empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyValidator::findViolations for flipped edges on multiple threads";
+
+      using Fp = double;
+
+      IndexedTriangulation<Fp> triangulation =
+         DelauneyTriangulation<Fp>{makeRandomPoints<Fp>(30000, 7777, 0.0, 1000.0)}
+            .triangulateIndexed(true);
+
+      // Flip edges of triangles that are far apart from each other, so that each
+      // flip only affects its own triangles.
+      std::vector<std::size_t> expected;
+      for (std::size_t idx = 0; idx < triangulation.numTriangles(); idx += 5000)
+      {
+         const std::size_t neighbor = triangulation.neighbors[3 * idx];
+         if (flipEdge(triangulation, idx))
+            expected.insert(expected.end(), {idx, neighbor});
+      }
+      std::sort(expected.begin(), expected.end());
+
+      VERIFY(!expected.empty(), caseLabel);
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangulation) == expected,
+             caseLabel);
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangulation, 4) == expected,
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DelauneyValidator::findViolations for points far from origin";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(1000, 7777, 0.0, 1000.0);
+      for (auto& pt : points)
+         pt = Point2<Fp>{1.0e9 + pt.x() / 1000.0, -1.0e9 + pt.y() / 1000.0};
+      const IndexedTriangulation<Fp> triangulation =
+         DelauneyTriangulation<Fp>{points}.triangulateIndexed();
+
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangulation).empty(), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDelauneyValidation()
+{
+   testFindViolationsForTriangles();
+   testFindViolationsForIndexedTriangulation();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for validation of Delauney triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDelauneyValidation();
@@ -0,0 +1,83 @@
+//
+// geomcpp tests
+// Tests for the reusable Delauney triangulation workspace.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "delauney_workspace_tests.h"
+#include "delauney_triangulation.h"
+#include "delauney_workspace.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "test_util.h"
+#include "triangle.h"
+#include <string>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+void testTriangulate()
+{
+   {
+      const std::string caseLabel = "DelauneyWorkspace::triangulate";
+
+      using Fp = double;
+
+      DelauneyWorkspace<Fp> workspace;
+      for (const std::size_t n : {100, 20, 300})
+      {
+         const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(n, 1000 + n);
+         const std::vector<Triangle<Fp>>& triangles = workspace.triangulate(points);
+         const std::vector<Triangle<Fp>> expected =
+            DelauneyTriangulation<Fp>{points}.triangulate();
+
+         VERIFY(triangles.size() == expected.size(), caseLabel);
+         bool isSame = true;
+         for (const auto& t : expected)
+            isSame = isSame && containsTriangle(triangles, t);
+         VERIFY(isSame, caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "DelauneyWorkspace::triangulate for collinear points";
+
+      using Fp = float;
+
+      DelauneyWorkspace<Fp> workspace;
+      workspace.triangulate(makeRandomPoints<Fp>(50, 2222));
+      const std::vector<Point2<Fp>> collinear{{0.0f, 0.0f}, {1.0f, 1.0f}, {2.0f, 2.0f}};
+
+      VERIFY(workspace.triangulate(collinear).empty(), caseLabel);
+      VERIFY(workspace.triangulateIndexed(collinear).numTriangles() == 0, caseLabel);
+      VERIFY(workspace.triangulateIndexed(collinear).vertices.empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel = "DelauneyWorkspace::triangulateIndexed";
+
+      using Fp = double;
+
+      DelauneyWorkspace<Fp> workspace;
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(200, 3333);
+      const IndexedTriangulation<Fp>& indexed = workspace.triangulateIndexed(points, true);
+      const IndexedTriangulation<Fp> expected =
+         DelauneyTriangulation<Fp>{points}.triangulateIndexed(true);
+
+      VERIFY(indexed.numTriangles() == expected.numTriangles(), caseLabel);
+      VERIFY(indexed.vertices.size() == expected.vertices.size(), caseLabel);
+      VERIFY(indexed.neighbors.size() == expected.neighbors.size(), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDelauneyWorkspace()
+{
+   testTriangulate();
+}
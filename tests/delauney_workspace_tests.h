@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for the reusable Delauney triangulation workspace.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDelauneyWorkspace();
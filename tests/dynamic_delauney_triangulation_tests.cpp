@@ -0,0 +1,175 @@
+//
+// geomcpp tests
+// Tests for Delauney triangulation with incremental updates.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "dynamic_delauney_triangulation_tests.h"
+#include "delauney_triangulation.h"
+#include "dynamic_delauney_triangulation.h"
+#include "point2.h"
+#include "rect.h"
+#include "test_util.h"
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+void testInsert()
+{
+   {
+      const std::string caseLabel = "DynamicDelauneyTriangulation::insert";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt{Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      VERIFY(dt.insert({1.0, 1.0}), caseLabel);
+      VERIFY(dt.insert({8.0, 2.0}), caseLabel);
+      VERIFY(dt.triangles().empty(), caseLabel);
+      VERIFY(dt.insert({4.0, 9.0}), caseLabel);
+
+      VERIFY(dt.size() == 3, caseLabel);
+      VERIFY(dt.triangles().size() == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DynamicDelauneyTriangulation::insert for point "
+                                    "outside of bounds";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt{Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      VERIFY(!dt.insert({11.0, 1.0}), caseLabel);
+      VERIFY(dt.size() == 0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DynamicDelauneyTriangulation::insert for "
+                                    "duplicate point";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt{Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      VERIFY(dt.insert({1.0, 1.0}), caseLabel);
+      VERIFY(!dt.insert({1.0, 1.0}), caseLabel);
+      VERIFY(dt.size() == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DynamicDelauneyTriangulation::insert without "
+                                    "bounds";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt;
+      VERIFY(dt.insert({1.0e8, 1.0}), caseLabel);
+      VERIFY(dt.insert({-1.0e8, 2.0}), caseLabel);
+      VERIFY(dt.insert({0.0, -5.0}), caseLabel);
+      VERIFY(dt.insert({0.0, 1.0e8}), caseLabel);
+
+      VERIFY(dt.size() == 4, caseLabel);
+      VERIFY(dt.triangles().size() == 2, caseLabel);
+   }
+}
+
+
+void testRemove()
+{
+   {
+      const std::string caseLabel = "DynamicDelauneyTriangulation::remove";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt{Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      dt.insert({1.0, 1.0});
+      dt.insert({8.0, 2.0});
+      dt.insert({4.0, 9.0});
+      dt.insert({4.0, 4.0});
+      VERIFY(dt.triangles().size() == 3, caseLabel);
+
+      VERIFY(dt.remove({4.0, 4.0}), caseLabel);
+      VERIFY(dt.size() == 3, caseLabel);
+      VERIFY(dt.triangles().size() == 1, caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "DynamicDelauneyTriangulation::remove for point that is not in triangulation";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt{Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      dt.insert({1.0, 1.0});
+      dt.insert({8.0, 2.0});
+
+      VERIFY(!dt.remove({4.0, 4.0}), caseLabel);
+      VERIFY(dt.size() == 2, caseLabel);
+   }
+   {
+      const std::string caseLabel = "DynamicDelauneyTriangulation::remove all points";
+
+      using Fp = double;
+
+      DynamicDelauneyTriangulation<Fp> dt{Rect<Fp>{0.0, 0.0, 100.0, 100.0}};
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(100, 6666);
+      for (const auto& pt : points)
+         dt.insert(pt);
+      for (const auto& pt : points)
+         dt.remove(pt);
+
+      VERIFY(dt.size() == 0, caseLabel);
+      VERIFY(dt.triangles().empty(), caseLabel);
+   }
+}
+
+
+void testUpdates()
+{
+   {
+      const std::string caseLabel =
+         "DynamicDelauneyTriangulation matches triangulation of remaining points";
+
+      using Fp = double;
+
+      const Rect<Fp> bounds{0.0, 0.0, 100.0, 100.0};
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(400, 6666);
+
+      // Interleave inserting points with removing earlier points.
+      DynamicDelauneyTriangulation<Fp> dt{bounds};
+      std::vector<Point2<Fp>> remaining;
+      for (std::size_t i = 0; i < points.size(); ++i)
+      {
+         dt.insert(points[i]);
+         if (i % 3 == 2)
+            dt.remove(points[i - 1]);
+         if (i % 3 != 1)
+            remaining.push_back(points[i]);
+      }
+
+      DynamicDelauneyTriangulation<Fp> expectedDt{bounds};
+      for (const auto& pt : remaining)
+         expectedDt.insert(pt);
+      const std::vector<Triangle<Fp>> triangles = dt.triangles();
+      const std::vector<Triangle<Fp>> expected = expectedDt.triangles();
+
+      VERIFY(dt.size() == remaining.size(), caseLabel);
+      VERIFY(triangles.size() == expected.size(), caseLabel);
+      bool isSame = true;
+      for (const auto& t : expected)
+         isSame = isSame && containsTriangle(triangles, t);
+      VERIFY(isSame, caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(triangles),
+             caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testDynamicDelauneyTriangulation()
+{
+   testInsert();
+   testRemove();
+   testUpdates();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for Delauney triangulation with incremental updates.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testDynamicDelauneyTriangulation();
@@ -9,6 +9,8 @@
 #include "geom_util.h"
 #include "test_util.h"
 #include "essentutils/fputil.h"
+#include <cmath>
+#include <vector>
 
 using namespace geom;
 using namespace sutil;
@@ -136,6 +138,60 @@ void testIsConvexPath()
    }
 }
 
+
+void testHilbertIndex()
+{
+   {
+      const std::string caseLabel = "hilbertIndex for 2x2 grid";
+
+      using Fp = double;
+
+      const Rect<Fp> bounds{0.0, 0.0, 2.0, 2.0};
+
+      VERIFY(hilbertIndex(Point2<Fp>{0.5, 0.5}, bounds, 1) == 0, caseLabel);
+      VERIFY(hilbertIndex(Point2<Fp>{0.5, 1.5}, bounds, 1) == 1, caseLabel);
+      VERIFY(hilbertIndex(Point2<Fp>{1.5, 1.5}, bounds, 1) == 2, caseLabel);
+      VERIFY(hilbertIndex(Point2<Fp>{1.5, 0.5}, bounds, 1) == 3, caseLabel);
+   }
+   {
+      const std::string caseLabel = "hilbertIndex for consecutive cells";
+
+      using Fp = double;
+
+      const Rect<Fp> bounds{0.0, 0.0, 8.0, 8.0};
+
+      // Each cell of a 8x8 grid has a unique index and cells with consecutive
+      // indices are adjacent.
+      std::vector<Point2<Fp>> cellByIdx(64);
+      for (int r = 0; r < 8; ++r)
+      {
+         for (int c = 0; c < 8; ++c)
+         {
+            const Point2<Fp> center{c + 0.5, r + 0.5};
+            cellByIdx[hilbertIndex(center, bounds, 3)] = center;
+         }
+      }
+
+      bool areAdjacent = true;
+      for (std::size_t i = 1; i < cellByIdx.size(); ++i)
+      {
+         const Fp dist = std::abs(cellByIdx[i].x() - cellByIdx[i - 1].x()) +
+                         std::abs(cellByIdx[i].y() - cellByIdx[i - 1].y());
+         areAdjacent = areAdjacent && dist == 1.0;
+      }
+      VERIFY(areAdjacent, caseLabel);
+   }
+   {
+      const std::string caseLabel = "hilbertIndex for point outside of bounds";
+
+      using Fp = float;
+
+      const Rect<Fp> bounds{0.0f, 0.0f, 2.0f, 2.0f};
+
+      VERIFY(hilbertIndex(Point2<Fp>{-1.0f, 0.5f}, bounds, 1) == 0, caseLabel);
+   }
+}
+
 } // namespace
 
 
@@ -145,4 +201,5 @@ void testGeometryUtilities()
 {
    testCalcPathBounds();
    testIsConvexPath();
+   testHilbertIndex();
 }
@@ -5,11 +5,22 @@
 // MIT license
 //
 #include "circle_tests.h"
+#include "constrained_delauney_triangulation_tests.h"
+#include "delauney_circumcircles_tests.h"
+#include "delauney_divide_conquer_tests.h"
+#include "delauney_mesh_tests.h"
+#include "delauney_point_locator_tests.h"
+#include "delauney_stats_tests.h"
 #include "delauney_triangle_tests.h"
 #include "delauney_triangulation_tests.h"
+#include "delauney_validation_tests.h"
+#include "delauney_workspace_tests.h"
+#include "dynamic_delauney_triangulation_tests.h"
 #include "geom_util_tests.h"
+#include "indexed_triangulation_tests.h"
 #include "interval_dec_tests.h"
 #include "interval_tec_tests.h"
+#include "kinetic_delauney_triangulation_tests.h"
 #include "line_inf2_ct_tests.h"
 #include "line_inf2_rt_tests.h"
 #include "line_intersection2_ct_tests.h"
@@ -19,34 +30,53 @@
 #include "line_seg2_ct_tests.h"
 #include "line_seg2_rt_tests.h"
 #include "point2_tests.h"
+#include "point_welder_tests.h"
 #include "poisson_disc_sampling_tests.h"
 #include "poly2_tests.h"
 #include "poly_intersection2_tests.h"
 #include "poly_line_cut2_tests.h"
+#include "predicates_tests.h"
 #include "rect_tests.h"
 #include "ring_tests.h"
 #include "triangle_tests.h"
 #include "vec2_tests.h"
+#include "voronoi_diagram_tests.h"
+#include "voronoi_fortune_tests.h"
+#include "voronoi_outline_tests.h"
 #include "voronoi_tesselation_tests.h"
+#include "voronoi_tile_locator_tests.h"
 #include <iostream>
 
 
 int main()
 {
    testCircle();
+   testConstrainedDelauneyTriangulation();
    testCtLineInf2();
    testCtLineIntersection2();
    testCtLineRay2();
    testCtLineSeg2();
    testDecInterval();
+   testDelauneyCircumcircles();
+   testDelauneyDivideConquer();
+   testDelauneyMesh();
+   testDelauneyPointLocator();
+   testDelauneyStats();
    testDelauneyTriangle();
    testDelauneyTriangulation();
+   testDelauneyValidation();
+   testDelauneyWorkspace();
+   testDynamicDelauneyTriangulation();
    testGeometryUtilities();
+   testIndexedTriangulation();
+   testKineticDelauneyTriangulation();
    testPoint2D();
+   testPointWelder();
    testPoissonDiscSampling();
    testPoly2();
    testPolygonIntersection2();
    testPolygonLineCutting2();
+   testPredicates();
    testRect();
    testRing();
    testRtLineInf2();
@@ -56,7 +86,11 @@ int main()
    testTecInterval();
    testTriangle();
    testVector2D();
+   testVoronoiDiagram();
+   testVoronoiFortune();
+   testVoronoiOutline();
    testVoronoiTesselation();
+   testVoronoiTileLocator();
 
    std::cout << "geomcpp tests finished.\n";
    return EXIT_SUCCESS;
@@ -0,0 +1,79 @@
+//
+// geomcpp tests
+// Tests for indexed triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "indexed_triangulation_tests.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "test_util.h"
+#include "triangle.h"
+#include <string>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+void testNumTriangles()
+{
+   {
+      const std::string caseLabel = "IndexedTriangulation::numTriangles for empty buffers";
+
+      using Fp = double;
+
+      const IndexedTriangulation<Fp> indexed;
+
+      VERIFY(indexed.numTriangles() == 0, caseLabel);
+      VERIFY(!indexed.hasNeighbors(), caseLabel);
+   }
+   {
+      const std::string caseLabel = "IndexedTriangulation::numTriangles";
+
+      using Fp = double;
+
+      IndexedTriangulation<Fp> indexed;
+      indexed.vertices = {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}};
+      indexed.indices = {0, 1, 2, 0, 2, 3};
+
+      VERIFY(indexed.numTriangles() == 2, caseLabel);
+   }
+}
+
+
+void testTriangle()
+{
+   {
+      const std::string caseLabel = "IndexedTriangulation::triangle";
+
+      using Fp = double;
+
+      IndexedTriangulation<Fp> indexed;
+      indexed.vertices = {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}};
+      indexed.indices = {0, 1, 2, 0, 2, 3};
+      indexed.neighbors = {IndexedTriangulation<Fp>::NoNeighbor, 1,
+                           IndexedTriangulation<Fp>::NoNeighbor,
+                           IndexedTriangulation<Fp>::NoNeighbor,
+                           IndexedTriangulation<Fp>::NoNeighbor, 0};
+
+      const Triangle<Fp> t = indexed.triangle(1);
+
+      VERIFY(indexed.hasNeighbors(), caseLabel);
+      VERIFY(t.hasVertex(Point2<Fp>{0.0, 0.0}), caseLabel);
+      VERIFY(t.hasVertex(Point2<Fp>{1.0, 1.0}), caseLabel);
+      VERIFY(t.hasVertex(Point2<Fp>{0.0, 1.0}), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testIndexedTriangulation()
+{
+   testNumTriangles();
+   testTriangle();
+}
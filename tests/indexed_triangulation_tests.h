@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for indexed triangulations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testIndexedTriangulation();
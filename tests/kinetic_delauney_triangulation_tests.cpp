@@ -0,0 +1,163 @@
+//
+// geomcpp tests
+// Tests for Delauney triangulation of moving points.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "kinetic_delauney_triangulation_tests.h"
+#include "delauney_triangulation.h"
+#include "delauney_validation.h"
+#include "kinetic_delauney_triangulation.h"
+#include "point2.h"
+#include "test_util.h"
+#include "vec2.h"
+#include "essentutils/rand_util.h"
+#include <string>
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+template <typename T>
+std::vector<Point2<T>> displace(const std::vector<Point2<T>>& points, T maxDist,
+                                unsigned int seed)
+{
+   Random<T> rand{-maxDist, maxDist, seed};
+   std::vector<Point2<T>> displaced;
+   for (const Point2<T>& pt : points)
+   {
+      const T dx = rand.next();
+      displaced.push_back(pt + Vec2<T>{dx, rand.next()});
+   }
+   return displaced;
+}
+
+
+///////////////////
+
+void testConstruction()
+{
+   {
+      const std::string caseLabel = "KineticDelauneyTriangulation ctor";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(500, 1111);
+      KineticDelauneyTriangulation<Fp> kinetic{points};
+
+      VERIFY(kinetic.size() == points.size(), caseLabel);
+      VERIFY(kinetic.position(123) == points[123], caseLabel);
+      const auto triangles = kinetic.triangles();
+      VERIFY(triangles.size() == DelauneyTriangulation<Fp>{points}.triangulate().size(),
+             caseLabel);
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangles).empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel = "KineticDelauneyTriangulation ctor without points";
+
+      using Fp = float;
+
+      KineticDelauneyTriangulation<Fp> kinetic{{}};
+
+      VERIFY(kinetic.size() == 0, caseLabel);
+      VERIFY(kinetic.triangles().empty(), caseLabel);
+      VERIFY(kinetic.update({}) == 0, caseLabel);
+   }
+}
+
+
+void testUpdate()
+{
+   {
+      const std::string caseLabel = "KineticDelauneyTriangulation::update for small moves";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(1000, 2222);
+      KineticDelauneyTriangulation<Fp> kinetic{points};
+
+      for (unsigned int step = 0; step < 10; ++step)
+      {
+         points = displace(points, 0.2, 100 + step);
+         VERIFY(kinetic.update(points) == 0, caseLabel);
+
+         const auto triangles = kinetic.triangles();
+         VERIFY(DelauneyValidator<Fp>::findViolations(triangles).empty(), caseLabel);
+         VERIFY(triangles.size() ==
+                   DelauneyTriangulation<Fp>{points}.triangulate().size(),
+                caseLabel);
+      }
+      VERIFY(kinetic.position(999) == points[999], caseLabel);
+
+      if constexpr (DelauneyStatsEnabled)
+      {
+         VERIFY(kinetic.stats().numFlips > 0, caseLabel);
+         // Most points stay within their triangles.
+         VERIFY(kinetic.stats().numReinsertedPoints < points.size(), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "KineticDelauneyTriangulation::update for large moves";
+
+      using Fp = float;
+
+      KineticDelauneyTriangulation<Fp> kinetic{makeRandomPoints<Fp>(300, 3333)};
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(300, 4444);
+
+      VERIFY(kinetic.update(points) == 0, caseLabel);
+      const auto triangles = kinetic.triangles();
+      VERIFY(DelauneyValidator<Fp>::findViolations(triangles).empty(), caseLabel);
+      VERIFY(triangles.size() == DelauneyTriangulation<Fp>{points}.triangulate().size(),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "KineticDelauneyTriangulation::update for collision";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{{0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0},
+                                           {0.0, 4.0}, {2.0, 1.0}};
+      KineticDelauneyTriangulation<Fp> kinetic{points};
+
+      std::vector<Point2<Fp>> moved = points;
+      moved[4] = {0.0, 4.0};
+      moved[0] = {-1.0, -1.0};
+
+      VERIFY(kinetic.update(moved) == 1, caseLabel);
+      VERIFY(kinetic.position(4) == Point2<Fp>(2.0, 1.0), caseLabel);
+      VERIFY(kinetic.position(0) == Point2<Fp>(-1.0, -1.0), caseLabel);
+      VERIFY(kinetic.triangles().size() == 4, caseLabel);
+   }
+   {
+      const std::string caseLabel = "KineticDelauneyTriangulation::update for duplicates";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{{0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0},
+                                           {4.0, 4.0}};
+      KineticDelauneyTriangulation<Fp> kinetic{points};
+      VERIFY(kinetic.triangles().size() == 1, caseLabel);
+
+      // The duplicate joins once it moves to a free position.
+      std::vector<Point2<Fp>> moved = points;
+      moved[3] = {0.0, 4.0};
+      VERIFY(kinetic.update(moved) == 0, caseLabel);
+      VERIFY(kinetic.triangles().size() == 2, caseLabel);
+      VERIFY(kinetic.position(3) == Point2<Fp>(0.0, 4.0), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testKineticDelauneyTriangulation()
+{
+   testConstruction();
+   testUpdate();
+}
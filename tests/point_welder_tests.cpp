@@ -0,0 +1,236 @@
+//
+// geomcpp tests
+// Tests for welding of points.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "point_welder_tests.h"
+#include "delauney_triangulation.h"
+#include "point2.h"
+#include "point_welder.h"
+#include "test_util.h"
+#include "voronoi_tesselation.h"
+#include "essentutils/rand_util.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+// Random points on a coarse grid, so that many of them are duplicates.
+template <typename T>
+std::vector<Point2<T>> makeDuplicatePoints(std::size_t n, unsigned int seed)
+{
+   Random<T> rand{T(0), T(100), seed};
+   std::vector<Point2<T>> points;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const T x = std::floor(rand.next());
+      points.emplace_back(x, std::floor(rand.next()));
+   }
+   return points;
+}
+
+
+// Checks that each original point is within a given distance of its welded
+// point.
+template <typename T>
+bool isMappingValid(const std::vector<Point2<T>>& points, const WeldedPoints<T>& welded,
+                    T maxDist)
+{
+   if (welded.mapping.size() != points.size())
+      return false;
+   for (std::size_t i = 0; i < points.size(); ++i)
+   {
+      if (welded.mapping[i] >= welded.points.size())
+         return false;
+      const Point2<T>& pt = welded.points[welded.mapping[i]];
+      if (std::abs(pt.x() - points[i].x()) > maxDist ||
+          std::abs(pt.y() - points[i].y()) > maxDist)
+         return false;
+   }
+   return true;
+}
+
+
+///////////////////
+
+void testWeld()
+{
+   {
+      const std::string caseLabel = "PointWelder::weld for exact duplicates";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{
+         {1.0, 2.0}, {3.0, 4.0}, {1.0, 2.0}, {5.0, 6.0}, {3.0, 4.0}, {1.0, 2.0}};
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points);
+
+      VERIFY(welded.points.size() == 3, caseLabel);
+      VERIFY(welded.points[0] == Point2<Fp>(1.0, 2.0), caseLabel);
+      VERIFY(welded.points[1] == Point2<Fp>(3.0, 4.0), caseLabel);
+      VERIFY(welded.points[2] == Point2<Fp>(5.0, 6.0), caseLabel);
+      VERIFY((welded.mapping == std::vector<std::uint32_t>{0, 1, 0, 2, 1, 0}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder::weld within epsilon";
+
+      using Fp = double;
+      const Fp eps = FpTraits<Fp>::epsilon;
+
+      const std::vector<Point2<Fp>> points{
+         {10.0, 10.0}, {10.0 + 0.5 * eps, 10.0 - 0.5 * eps}, {10.0 + 3.0 * eps, 10.0}};
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points);
+
+      VERIFY(welded.points.size() == 2, caseLabel);
+      VERIFY((welded.mapping == std::vector<std::uint32_t>{0, 0, 1}), caseLabel);
+      // Welded points are equal to their original points.
+      for (std::size_t i = 0; i < points.size(); ++i)
+         VERIFY(welded.points[welded.mapping[i]] == points[i], caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder::weld for chain of close points";
+
+      using Fp = float;
+
+      const std::vector<Point2<Fp>> points{
+         {0.0f, 0.0f}, {0.7f, 0.0f}, {1.4f, 0.0f}, {2.1f, 0.0f}, {5.0f, 0.0f}};
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points, 1.0f);
+
+      VERIFY(welded.points.size() == 2, caseLabel);
+      VERIFY((welded.mapping == std::vector<std::uint32_t>{0, 0, 0, 0, 1}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder::weld across cell borders";
+
+      using Fp = double;
+
+      // Close points on both sides of a cell border are welded.
+      const std::vector<Point2<Fp>> points{
+         {1.99, -0.01}, {2.01, 0.01}, {-2.01, 1.99}, {-1.99, 2.01}};
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points, 0.05);
+
+      VERIFY((welded.mapping == std::vector<std::uint32_t>{0, 0, 1, 1}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder::weld for integer points";
+
+      using Int = int;
+
+      const std::vector<Point2<Int>> points{{1, 2}, {1, 3}, {1, 2}, {2, 2}};
+      const WeldedPoints<Int> welded = PointWelder<Int>::weld(points);
+
+      VERIFY(welded.points.size() == 3, caseLabel);
+      VERIFY((welded.mapping == std::vector<std::uint32_t>{0, 1, 0, 2}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder::weld for large coordinates";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points{
+         {5.0e6, -3.0e6}, {-1.0e30, 1.0e30}, {5.0e6, -3.0e6}, {-1.0e30, 1.0e30}};
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points);
+
+      VERIFY((welded.mapping == std::vector<std::uint32_t>{0, 1, 0, 1}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder::weld without points";
+
+      using Fp = float;
+
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld({});
+
+      VERIFY(welded.points.empty(), caseLabel);
+      VERIFY(welded.mapping.empty(), caseLabel);
+   }
+}
+
+
+void testParallelWeld()
+{
+   {
+      const std::string caseLabel = "PointWelder::weld with multiple threads";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points = makeDuplicatePoints<Fp>(50000, 1234);
+      const WeldedPoints<Fp> single = PointWelder<Fp>::weld(points, 0.0, 1);
+      const WeldedPoints<Fp> parallel = PointWelder<Fp>::weld(points, 0.0, 4);
+
+      // At most 100 x 100 grid positions.
+      VERIFY(single.points.size() <= 10000, caseLabel);
+      VERIFY(isMappingValid(points, single, 0.0), caseLabel);
+      VERIFY(parallel.points == single.points, caseLabel);
+      VERIFY(parallel.mapping == single.mapping, caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "PointWelder::weld with tolerance and multiple threads";
+
+      using Fp = float;
+
+      std::vector<Point2<Fp>> points = makeDuplicatePoints<Fp>(30000, 2345);
+      Random<Fp> rand{-0.001f, 0.001f, 3456};
+      for (auto& pt : points)
+      {
+         const Fp dx = rand.next();
+         pt = Point2<Fp>{pt.x() + dx, pt.y() + rand.next()};
+      }
+      const WeldedPoints<Fp> single = PointWelder<Fp>::weld(points, 0.01f, 1);
+      const WeldedPoints<Fp> parallel = PointWelder<Fp>::weld(points, 0.01f, 3);
+
+      VERIFY(isMappingValid(points, single, 0.002f), caseLabel);
+      VERIFY(parallel.points == single.points, caseLabel);
+      VERIFY(parallel.mapping == single.mapping, caseLabel);
+   }
+}
+
+
+void testFrontEnd()
+{
+   {
+      const std::string caseLabel = "PointWelder as front end of DelauneyTriangulation";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points = makeDuplicatePoints<Fp>(2000, 4567);
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points);
+      const IndexedTriangulation<Fp> triangulation =
+         DelauneyTriangulation<Fp>{welded.points}.triangulateIndexed();
+
+      VERIFY(triangulation.vertices.size() == welded.points.size(), caseLabel);
+      VERIFY(DelauneyTriangulation<Fp>::isDelauneyConditionSatisfied(
+                DelauneyTriangulation<Fp>{welded.points}.triangulate()),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "PointWelder as front end of VoronoiTesselation";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> points = makeDuplicatePoints<Fp>(300, 5678);
+      const WeldedPoints<Fp> welded = PointWelder<Fp>::weld(points);
+      VoronoiTesselation<Fp> voronoi{welded.points};
+      const auto tiles = voronoi.tesselate();
+
+      VERIFY(tiles.size() == welded.points.size(), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testPointWelder()
+{
+   testWeld();
+   testParallelWeld();
+   testFrontEnd();
+}
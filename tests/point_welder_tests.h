@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for welding of points.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testPointWelder();
@@ -357,6 +357,35 @@ void testIsectForGeneralPolygons()
       VERIFY(expected == intersectConvexPolygons(P, Q), caseLabel);
       VERIFY(expected == intersectConvexPolygons(Q, P), caseLabel);
    }
+   {
+      const std::string caseLabel =
+         "Convex polygon intersection for start vertex far from intersection";
+
+      // Starting at vertex (7, 8) of P, the first intersection is found late. With
+      // an iteration limit of two laps around both polygons it was lost.
+      Poly2<double> P;
+      P.add(Point2(7.0, 8.0));
+      P.add(Point2(0.0, 7.0));
+      P.add(Point2(1.0, 0.0));
+      P.add(Point2(7.0, 0.0));
+      Poly2<double> Q;
+      Q.add(Point2(4.0, 2.0));
+      Q.add(Point2(7.0, 1.0));
+      Q.add(Point2(8.0, 1.0));
+      Q.add(Point2(6.0, 6.0));
+      Q.add(Point2(5.0, 7.0));
+      Q.add(Point2(4.0, 7.0));
+
+      Poly2<double> expected;
+      expected.add(Point2(7.0, 3.5));
+      expected.add(Point2(7.0, 1.0));
+      expected.add(Point2(4.0, 2.0));
+      expected.add(Point2(4.0, 7.0));
+      expected.add(Point2(5.0, 7.0));
+      expected.add(Point2(6.0, 6.0));
+
+      VERIFY(expected == intersectConvexPolygons(P, Q), caseLabel);
+   }
 }
 
 
@@ -146,4 +146,19 @@ void testPolygonLineCutting2()
          VERIFY(res[1].size() == 6, caseLabel);
       }
    }
+   {
+      const std::string caseLabel =
+         "cutConvexPolygon for polygon touched by the line at a rounded point";
+
+      // The vector from the anchor to the touching point is rounded and would
+      // put the point off the line.
+      ct::LineInf2<double> l(Point2(1.1, 0.1), Vec2(3.0, 1.0));
+      Poly2<double> p{Point2{4.1, 1.1}, Point2{5.0, -1.0}, Point2{6.0, 1.0}};
+
+      const std::vector<Poly2<double>> res = cutConvexPolygon(p, l);
+
+      VERIFY(res.size() == 1, caseLabel);
+      if (res.size() == 1)
+         VERIFY(res[0] == p, caseLabel);
+   }
 }
@@ -0,0 +1,138 @@
+//
+// geomcpp tests
+// Tests for geometric predicates.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "predicates_tests.h"
+#include "point2.h"
+#include "predicates.h"
+#include "test_util.h"
+#include <cmath>
+#include <limits>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+int sign(double val)
+{
+   return val > 0 ? 1 : (val < 0 ? -1 : 0);
+}
+
+
+void testOrient2d()
+{
+   {
+      const std::string caseLabel = "orient2d for ccw, cw and collinear points";
+
+      using Fp = double;
+
+      const Point2<Fp> a{0.0, 0.0};
+      const Point2<Fp> b{4.0, 0.0};
+
+      VERIFY(orient2d(a, b, Point2<Fp>{2.0, 3.0}) > 0, caseLabel);
+      VERIFY(orient2d(a, b, Point2<Fp>{2.0, -3.0}) < 0, caseLabel);
+      VERIFY(orient2d(a, b, Point2<Fp>{8.0, 0.0}) == 0, caseLabel);
+      VERIFY(orient2d(a, b, Point2<Fp>{2.0, 3.0}) == 12.0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "orient2d for float points";
+
+      using Fp = float;
+
+      const Point2<Fp> a{0.0f, 0.0f};
+      const Point2<Fp> b{4.0f, 0.0f};
+
+      VERIFY(orient2d(a, b, Point2<Fp>{2.0f, 3.0f}) > 0, caseLabel);
+      VERIFY(orient2d(a, b, Point2<Fp>{2.0f, -3.0f}) < 0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "orient2d for points close to a line";
+
+      using Fp = double;
+
+      // Points on a tiny grid around (0.5, 0.5) tested against the line y = x.
+      // A plain floating point determinant gets many of these wrong.
+      const Point2<Fp> b{12.0, 12.0};
+      const Point2<Fp> c{24.0, 24.0};
+      const Fp ulp = std::numeric_limits<Fp>::epsilon() / 2;
+
+      bool isCorrect = true;
+      for (int i = 0; i < 64; ++i)
+      {
+         for (int j = 0; j < 64; ++j)
+         {
+            const Point2<Fp> a{0.5 + i * ulp, 0.5 + j * ulp};
+            // Points above the line are left of it.
+            const int expected = sign(j - i);
+            isCorrect = isCorrect && sign(orient2d(b, c, a)) == expected &&
+                        sign(orient2d(a, b, c)) == expected &&
+                        sign(orient2d(c, b, a)) == -expected;
+         }
+      }
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+
+void testInCircle()
+{
+   {
+      const std::string caseLabel = "inCircle for points inside, outside and on circle";
+
+      using Fp = double;
+
+      const Point2<Fp> a{0.0, 0.0};
+      const Point2<Fp> b{4.0, 0.0};
+      const Point2<Fp> c{4.0, 4.0};
+
+      VERIFY(inCircle(a, b, c, Point2<Fp>{2.0, 2.0}) > 0, caseLabel);
+      VERIFY(inCircle(a, b, c, Point2<Fp>{6.0, 6.0}) < 0, caseLabel);
+      VERIFY(inCircle(a, b, c, Point2<Fp>{0.0, 4.0}) == 0, caseLabel);
+      // Reversed sign for cw points.
+      VERIFY(inCircle(a, c, b, Point2<Fp>{2.0, 2.0}) < 0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "inCircle for points close to a circle";
+
+      using Fp = double;
+
+      // Circle x^2 + y^2 - x - y = 0 through (0, 0), (1, 0), (0, 1) and (1, 1).
+      // Perturbing (1, 1) by (i, j) ulps moves it inside the circle if i + j < 0
+      // and outside otherwise, unless both are zero.
+      const Point2<Fp> a{0.0, 0.0};
+      const Point2<Fp> b{1.0, 0.0};
+      const Point2<Fp> c{0.0, 1.0};
+      const Fp ulp = std::numeric_limits<Fp>::epsilon();
+
+      bool isCorrect = true;
+      for (int i = -8; i <= 8; ++i)
+      {
+         for (int j = -8; j <= 8; ++j)
+         {
+            const Point2<Fp> d{1.0 + i * ulp, 1.0 + j * ulp};
+            int expected = -sign(i + j);
+            if (i + j == 0 && i != 0)
+               expected = -1;
+            isCorrect = isCorrect && sign(inCircle(a, b, c, d)) == expected &&
+                        sign(inCircle(b, c, a, d)) == expected &&
+                        sign(inCircle(a, c, b, d)) == -expected;
+         }
+      }
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testPredicates()
+{
+   testOrient2d();
+   testInCircle();
+}
@@ -6,10 +6,18 @@
 // MIT license
 //
 #pragma once
+#include "point2.h"
+#include "poly2.h"
+#include "triangle.h"
+#include "voronoi_tile.h"
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <iostream>
+#include <random>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 
 namespace test_detail
@@ -90,6 +98,57 @@ bool verifyThrow(std::function<void()> toVerify, const std::string& label,
 }
 
 
+// Creates points with coordinates in range [min, max). The same seed always
+// creates the same points. Uses the generator and distribution of
+// sutil::Random, which cannot be included here because its header is not
+// guarded against multiple inclusion.
+template <typename T>
+std::vector<geom::Point2<T>> makeRandomPoints(std::size_t n, unsigned int seed,
+                                              T min = T(0), T max = T(100))
+{
+   std::mt19937 gen{seed};
+   std::uniform_real_distribution<T> dist{min, max};
+   std::vector<geom::Point2<T>> points;
+   points.reserve(n);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const T x = dist(gen);
+      points.emplace_back(x, dist(gen));
+   }
+   return points;
+}
+
+
+// Checks if a list of triangles contains a triangle with the same vertices as
+// a given triangle in any order.
+template <typename T>
+bool containsTriangle(const std::vector<geom::Triangle<T>>& triangles,
+                      const geom::Triangle<T>& t)
+{
+   for (const auto& candidate : triangles)
+      if (candidate.hasVertex(t[0]) && candidate.hasVertex(t[1]) &&
+          candidate.hasVertex(t[2]))
+         return true;
+   return false;
+}
+
+
+// Calculates the area of a tile's outline.
+template <typename T> double calcArea(const geom::VoronoiTile<T>& t)
+{
+   const geom::Poly2<T>& outline = t.outline();
+   double twiceArea = 0.0;
+   for (std::size_t i = 0; i < outline.size(); ++i)
+   {
+      const geom::Point2<T>& a = outline[i];
+      const geom::Point2<T>& b = outline[(i + 1) % outline.size()];
+      twiceArea += static_cast<double>(a.x()) * b.y() -
+                   static_cast<double>(b.x()) * a.y();
+   }
+   return std::abs(twiceArea) / 2.0;
+}
+
+
 #define VERIFY(cond, label) (verify(cond, label, #cond, __FILE__, __LINE__))
 #define VERIFY_THROW(toVerify, Exception, label)                                         \
    (verifyThrow<Exception>(toVerify, label, __FILE__, __LINE__))
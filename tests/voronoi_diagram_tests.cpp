@@ -0,0 +1,262 @@
+//
+// geomcpp tests
+// Tests for Voronoi diagrams.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "voronoi_diagram_tests.h"
+#include "point2.h"
+#include "poly2.h"
+#include "rect.h"
+#include "test_util.h"
+#include "voronoi_diagram.h"
+#include "voronoi_tesselation.h"
+#include "voronoi_tile.h"
+#include "essentutils/fputil.h"
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+// Calculates the signed area of a polygon. Positive for ccw polygons
+// (cartesian coordinate system).
+template <typename T> double calcArea(const Poly2<T>& poly)
+{
+   double twiceArea = 0.0;
+   for (std::size_t i = 0; i < poly.size(); ++i)
+   {
+      const Point2<T>& a = poly[i];
+      const Point2<T>& b = poly[(i + 1) % poly.size()];
+      twiceArea += static_cast<double>(a.x()) * b.y() -
+                   static_cast<double>(b.x()) * a.y();
+   }
+   return twiceArea / 2.0;
+}
+
+
+// Checks that the cells of a diagram match the tiles of a tesselation.
+template <typename T>
+bool haveSameCells(const VoronoiDiagram<T>& diagram,
+                   const std::vector<VoronoiTile<T>>& tiles)
+{
+   std::map<std::pair<T, T>, double> tileAreas;
+   for (const auto& tile : tiles)
+      tileAreas[{tile.seed().x(), tile.seed().y()}] = std::abs(calcArea(tile.outline()));
+
+   std::size_t numCells = 0;
+   for (std::uint32_t site = 0; site < diagram.numCells(); ++site)
+   {
+      const Poly2<T> outline = diagram.cellOutline(site);
+      if (outline.size() == 0)
+         continue;
+      ++numCells;
+
+      const auto pos = tileAreas.find({diagram.sites[site].x(), diagram.sites[site].y()});
+      if (pos == tileAreas.end() || !fpEqual(pos->second, calcArea(outline), 1e-6))
+         return false;
+   }
+   return numCells == tiles.size();
+}
+
+
+// Checks that each edge belongs to the cells of the sites on its sides.
+template <typename T> bool isConsistent(const VoronoiDiagram<T>& diagram)
+{
+   std::vector<std::size_t> numUses(diagram.edges.size(), 0);
+   for (std::uint32_t site = 0; site < diagram.numCells(); ++site)
+   {
+      for (std::uint32_t i = diagram.firstCellEdge[site];
+           i < diagram.firstCellEdge[site + 1]; ++i)
+      {
+         const auto& e = diagram.edges[diagram.cellEdges[i]];
+         if (e.left != site && e.right != site)
+            return false;
+         ++numUses[diagram.cellEdges[i]];
+      }
+   }
+
+   for (std::size_t i = 0; i < diagram.edges.size(); ++i)
+   {
+      const bool isOnBorder = diagram.edges[i].right == VoronoiDiagram<T>::NoSite;
+      if (numUses[i] != (isOnBorder ? 1 : 2))
+         return false;
+   }
+   return true;
+}
+
+
+///////////////////
+
+void testTesselateIndexed()
+{
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation::tesselateIndexed for random points";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> samples = makeRandomPoints<Fp>(1000, 1234);
+      for (const auto algorithm :
+           {VoronoiAlgorithm::DelauneyDual, VoronoiAlgorithm::Fortune})
+      {
+         for (const Rect<Fp>& border : {Rect<Fp>{0.0, 0.0, 100.0, 100.0},
+                                        Rect<Fp>{-20.0, -20.0, 120.0, 120.0},
+                                        Rect<Fp>{30.0, 20.0, 60.0, 80.0}})
+         {
+            const VoronoiDiagram<Fp> diagram =
+               VoronoiTesselation<Fp>{samples, border, algorithm}.tesselateIndexed();
+            const std::vector<VoronoiTile<Fp>> tiles =
+               VoronoiTesselation<Fp>{samples, border, algorithm}.tesselate();
+
+            VERIFY(diagram.numCells() == samples.size(), caseLabel);
+            VERIFY(haveSameCells(diagram, tiles), caseLabel);
+            VERIFY(isConsistent(diagram), caseLabel);
+         }
+      }
+   }
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation::tesselateIndexed for grid points";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> samples;
+      for (int x = 0; x < 3; ++x)
+         for (int y = 0; y < 3; ++y)
+            samples.emplace_back(x, y);
+      VoronoiTesselation<Fp> vt{samples, Rect<Fp>{-0.5, -0.5, 2.5, 2.5}};
+      const VoronoiDiagram<Fp> diagram = vt.tesselateIndexed();
+
+      // Sites that share a circle share a vertex.
+      VERIFY(diagram.vertices.size() == 16, caseLabel);
+      VERIFY(diagram.edges.size() == 24, caseLabel);
+      VERIFY(isConsistent(diagram), caseLabel);
+
+      for (std::uint32_t site = 0; site < diagram.numCells(); ++site)
+      {
+         VERIFY(fpEqual(calcArea(diagram.cellOutline(site)), 1.0), caseLabel);
+
+         // Neighbors are the sites at distance one.
+         std::set<std::uint32_t> neighbors;
+         for (std::uint32_t i = diagram.firstCellEdge[site];
+              i < diagram.firstCellEdge[site + 1]; ++i)
+         {
+            const std::uint32_t neighbor = diagram.neighbor(diagram.cellEdges[i], site);
+            if (neighbor != VoronoiDiagram<Fp>::NoSite)
+               neighbors.insert(neighbor);
+         }
+         const Point2<Fp>& pt = diagram.sites[site];
+         const std::size_t numExpected =
+            (pt.x() == 1.0 ? 2 : 1) + (pt.y() == 1.0 ? 2 : 1);
+         VERIFY(neighbors.size() == numExpected, caseLabel);
+         for (const std::uint32_t neighbor : neighbors)
+         {
+            const Point2<Fp>& other = diagram.sites[neighbor];
+            const Fp dist = std::abs(other.x() - pt.x()) + std::abs(other.y() - pt.y());
+            VERIFY(fpEqual(dist, 1.0), caseLabel);
+         }
+      }
+   }
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation::tesselateIndexed for border inside of one cell";
+
+      using Fp = float;
+
+      VoronoiTesselation<Fp> vt{{{0.0f, 0.0f}, {10.0f, 0.0f}, {5.0f, 20.0f}},
+                                Rect<Fp>{4.0f, 15.0f, 6.0f, 16.0f}};
+      const VoronoiDiagram<Fp> diagram = vt.tesselateIndexed();
+
+      VERIFY(diagram.numCells() == 3, caseLabel);
+      VERIFY(diagram.edges.size() == 4, caseLabel);
+      VERIFY(isConsistent(diagram), caseLabel);
+      for (std::uint32_t site = 0; site < diagram.numCells(); ++site)
+      {
+         const bool isClosest = diagram.sites[site] == Point2<Fp>{5.0f, 20.0f};
+         VERIFY(fpEqual(calcArea(diagram.cellOutline(site)), isClosest ? 2.0 : 0.0),
+                caseLabel);
+      }
+   }
+}
+
+
+void testDegenerateSamples()
+{
+   {
+      const std::string caseLabel = "VoronoiTesselation::tesselateIndexed for one point";
+
+      using Fp = double;
+
+      VoronoiTesselation<Fp> vt{{{1.0, 1.0}}, Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      const VoronoiDiagram<Fp> diagram = vt.tesselateIndexed();
+
+      VERIFY(diagram.numCells() == 1, caseLabel);
+      VERIFY(diagram.vertices.size() == 4, caseLabel);
+      VERIFY(fpEqual(calcArea(diagram.cellOutline(0)), 100.0), caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTesselation::tesselateIndexed for two points";
+
+      using Fp = double;
+
+      VoronoiTesselation<Fp> vt{{{2.0, 5.0}, {6.0, 5.0}}, Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      const VoronoiDiagram<Fp> diagram = vt.tesselateIndexed();
+
+      VERIFY(diagram.numCells() == 2, caseLabel);
+      VERIFY(isConsistent(diagram), caseLabel);
+      for (std::uint32_t site = 0; site < diagram.numCells(); ++site)
+      {
+         const double expected = diagram.sites[site].x() < 4.0 ? 40.0 : 60.0;
+         VERIFY(fpEqual(calcArea(diagram.cellOutline(site)), expected), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation::tesselateIndexed for collinear points";
+
+      using Fp = double;
+
+      VoronoiTesselation<Fp> vt{{{1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}, {4.0, 4.0}},
+                                Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      const VoronoiDiagram<Fp> diagram = vt.tesselateIndexed();
+
+      VERIFY(diagram.numCells() == 4, caseLabel);
+      VERIFY(isConsistent(diagram), caseLabel);
+      double area = 0.0;
+      for (std::uint32_t site = 0; site < diagram.numCells(); ++site)
+         area += calcArea(diagram.cellOutline(site));
+      VERIFY(fpEqual(area, 100.0), caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTesselation::tesselateIndexed for no points";
+
+      using Fp = double;
+
+      VoronoiTesselation<Fp> vt{{}, Rect<Fp>{0.0, 0.0, 10.0, 10.0}};
+      const VoronoiDiagram<Fp> diagram = vt.tesselateIndexed();
+
+      VERIFY(diagram.numCells() == 0, caseLabel);
+      VERIFY(diagram.edges.empty(), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testVoronoiDiagram()
+{
+   testTesselateIndexed();
+   testDegenerateSamples();
+}
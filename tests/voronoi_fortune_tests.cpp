@@ -0,0 +1,171 @@
+//
+// geomcpp tests
+// Tests for Fortune's sweep line algorithm for Voronoi tesselations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "voronoi_fortune_tests.h"
+#include "point2.h"
+#include "rect.h"
+#include "test_util.h"
+#include "voronoi_fortune.h"
+#include "voronoi_tesselation.h"
+#include "voronoi_tile.h"
+#include "essentutils/fputil.h"
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace geom;
+using namespace sutil;
+
+
+namespace
+{
+///////////////////
+
+// Checks that the tiles of both algorithms have the same seeds and areas.
+template <typename T>
+bool haveSameTiles(const std::vector<Point2<T>>& samples, const Rect<T>& border)
+{
+   const auto dualTiles =
+      VoronoiTesselation<T>{samples, border, VoronoiAlgorithm::DelauneyDual}.tesselate();
+   const auto fortuneTiles =
+      VoronoiTesselation<T>{samples, border, VoronoiAlgorithm::Fortune}.tesselate();
+   if (dualTiles.size() != fortuneTiles.size())
+      return false;
+
+   std::map<std::pair<T, T>, double> dualAreas;
+   for (const auto& tile : dualTiles)
+      dualAreas[{tile.seed().x(), tile.seed().y()}] = calcArea(tile);
+
+   for (const auto& tile : fortuneTiles)
+   {
+      const auto pos = dualAreas.find({tile.seed().x(), tile.seed().y()});
+      if (pos == dualAreas.end() || !fpEqual(pos->second, calcArea(tile), 1e-6))
+         return false;
+   }
+   return true;
+}
+
+
+///////////////////
+
+void testSweep()
+{
+   {
+      const std::string caseLabel = "VoronoiFortune for bounded tile";
+
+      using Fp = double;
+
+      const internals::VoronoiFortune<Fp> fortune{
+         {{0.0, 0.0}, {4.0, 0.0}, {2.0, 4.0}, {2.0, 1.0}}};
+      VERIFY(fortune.numSites() == 4, caseLabel);
+
+      // The center point is the only one with a bounded tile.
+      internals::VoronoiOutline<Fp> outline;
+      for (std::uint32_t i = 0; i < fortune.numSites(); ++i)
+      {
+         fortune.build(i, outline);
+         const bool isCenter = fortune.site(i) == Point2<Fp>{2.0, 1.0};
+         VERIFY(outline.isUnbounded != isCenter, caseLabel);
+         VERIFY(outline.vertices.size() == (isCenter ? 3 : 2), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "VoronoiFortune for collinear points";
+
+      using Fp = float;
+
+      const internals::VoronoiFortune<Fp> fortune{
+         {{1.0f, 1.0f}, {2.0f, 2.0f}, {3.0f, 3.0f}, {5.0f, 5.0f}}};
+      VERIFY(fortune.numSites() == 0, caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiFortune for duplicate points";
+
+      using Fp = double;
+
+      const internals::VoronoiFortune<Fp> fortune{
+         {{0.0, 0.0}, {4.0, 0.0}, {0.0, 0.0}, {2.0, 4.0}, {4.0, 0.0}}};
+      VERIFY(fortune.numSites() == 3, caseLabel);
+   }
+}
+
+
+void testTesselate()
+{
+   {
+      const std::string caseLabel = "VoronoiTesselation with Fortune for four points";
+
+      using Fp = double;
+
+      VoronoiTesselation<Fp> vt({{-1.0, -2.0}, {0.0, 3.0}, {4.0, 1.0}, {3.0, -1.0}},
+                                VoronoiAlgorithm::Fortune);
+      const std::vector<VoronoiTile<Fp>> tiles = vt.tesselate();
+
+      VERIFY(tiles.size() == 4, caseLabel);
+      double area = 0.0;
+      for (const auto& tile : tiles)
+         area += calcArea(tile);
+      VERIFY(fpEqual(area, 25.0, 1e-9), caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTesselation with Fortune for grid points";
+
+      using Fp = double;
+
+      // Rows of sites with the same y-coordinate and four sites on each circle.
+      std::vector<Point2<Fp>> samples;
+      for (int x = 0; x < 5; ++x)
+         for (int y = 0; y < 4; ++y)
+            samples.emplace_back(x, y);
+      VoronoiTesselation<Fp> vt(samples, Rect<Fp>{-0.5, -0.5, 4.5, 3.5},
+                                VoronoiAlgorithm::Fortune);
+      const std::vector<VoronoiTile<Fp>> tiles = vt.tesselate();
+
+      VERIFY(tiles.size() == samples.size(), caseLabel);
+      for (const auto& tile : tiles)
+      {
+         VERIFY(tile.outline().size() == 4, caseLabel);
+         VERIFY(fpEqual(calcArea(tile), 1.0, 1e-9), caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation with Fortune for same tiles as Delauney dual";
+
+      using Fp = double;
+
+      VERIFY(haveSameTiles(makeRandomPoints<Fp>(1000, 1234),
+                           Rect<Fp>{0.0, 0.0, 100.0, 100.0}),
+             caseLabel);
+      VERIFY(haveSameTiles(makeRandomPoints<Fp>(500, 2345),
+                           Rect<Fp>{-20.0, -20.0, 120.0, 120.0}),
+             caseLabel);
+      VERIFY(haveSameTiles(makeRandomPoints<Fp>(500, 3456),
+                           Rect<Fp>{30.0, 20.0, 60.0, 80.0}),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation with Fortune for same tiles as Delauney dual with float";
+
+      using Fp = float;
+
+      VERIFY(haveSameTiles(makeRandomPoints<Fp>(300, 4567),
+                           Rect<Fp>{0.0f, 0.0f, 100.0f, 100.0f}),
+             caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testVoronoiFortune()
+{
+   testSweep();
+   testTesselate();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for Fortune's sweep line algorithm for Voronoi tesselations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testVoronoiFortune();
@@ -0,0 +1,195 @@
+//
+// geomcpp tests
+// Tests for outlines of Voronoi tiles.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "voronoi_outline_tests.h"
+#include "point2.h"
+#include "poly2.h"
+#include "rect.h"
+#include "test_util.h"
+#include "vec2.h"
+#include "voronoi_outline.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+// Verifies that a polygon has given vertices. Avoids depending on the order of
+// the vertices.
+template <typename T>
+bool hasVertices(const std::vector<Point2<T>>& poly, const std::vector<Point2<T>>& pts)
+{
+   if (poly.size() != pts.size())
+      return false;
+
+   for (const auto& pt : pts)
+      if (std::find(poly.begin(), poly.end(), pt) == poly.end())
+         return false;
+   return true;
+}
+
+
+template <typename T>
+bool hasVertices(const Poly2<T>& poly, const std::vector<Point2<T>>& pts)
+{
+   return hasVertices(std::vector<Point2<T>>{poly.begin(), poly.end()}, pts);
+}
+
+
+///////////////////
+
+void testClipPolygon()
+{
+   {
+      const std::string caseLabel = "internals::clipPolygon for polygon inside";
+
+      using Fp = double;
+
+      const std::vector<Point2<Fp>> orig{{1.0, 1.0}, {3.0, 1.0}, {2.0, 4.0}};
+      std::vector<Point2<Fp>> poly = orig;
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      // Untouched, including the order of the vertices.
+      VERIFY(poly == orig, caseLabel);
+   }
+   {
+      const std::string caseLabel = "internals::clipPolygon for polygon outside";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> poly{{11.0, 1.0}, {13.0, 1.0}, {12.0, 4.0}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      VERIFY(poly.empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "internals::clipPolygon for polygon outside with overlapping bounds";
+
+      using Fp = double;
+
+      // The bounding box overlaps the corner of the rectangle.
+      std::vector<Point2<Fp>> poly{{9.0, 12.0}, {12.0, 9.0}, {12.0, 12.0}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      VERIFY(poly.empty(), caseLabel);
+   }
+   {
+      const std::string caseLabel = "internals::clipPolygon for polygon across one side";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> poly{{-2.0, 2.0}, {2.0, 2.0}, {2.0, 6.0}, {-2.0, 6.0}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      VERIFY(hasVertices(poly, {{0.0, 2.0}, {2.0, 2.0}, {2.0, 6.0}, {0.0, 6.0}}),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "internals::clipPolygon for polygon around rectangle";
+
+      using Fp = float;
+
+      std::vector<Point2<Fp>> poly{{5.0f, -10.0f}, {20.0f, 5.0f}, {5.0f, 20.0f},
+                                   {-10.0f, 5.0f}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0f, 0.0f, 10.0f, 10.0f}, buffer);
+
+      VERIFY(hasVertices(poly, {{0.0f, 0.0f}, {10.0f, 0.0f}, {10.0f, 10.0f},
+                                {0.0f, 10.0f}}),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "internals::clipPolygon for polygon across corner";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> poly{{8.0, 8.0}, {12.0, 8.0}, {12.0, 12.0}, {8.0, 12.0}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      VERIFY(hasVertices(poly, {{8.0, 8.0}, {10.0, 8.0}, {10.0, 10.0}, {8.0, 10.0}}),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "internals::clipPolygon for polygon with vertex on side";
+
+      using Fp = double;
+
+      // No duplicate vertices where the polygon touches the side.
+      std::vector<Point2<Fp>> poly{{0.0, 5.0}, {4.0, 1.0}, {4.0, 9.0}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      VERIFY(hasVertices(poly, {{0.0, 5.0}, {4.0, 1.0}, {4.0, 9.0}}), caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "internals::clipPolygon for polygon that touches rectangle";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> poly{{10.0, 2.0}, {14.0, 2.0}, {14.0, 6.0}, {10.0, 6.0}};
+      std::vector<Point2<Fp>> buffer;
+      internals::clipPolygon(poly, Rect<Fp>{0.0, 0.0, 10.0, 10.0}, buffer);
+
+      VERIFY(poly.empty(), caseLabel);
+   }
+}
+
+
+void testClipOutline()
+{
+   {
+      const std::string caseLabel = "internals::clipOutline for bounded outline";
+
+      using Fp = double;
+
+      internals::VoronoiOutline<Fp> outline;
+      outline.vertices = {{-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {-1.0, 1.0}};
+      const Poly2<Fp> clipped =
+         internals::clipOutline(outline, Rect<Fp>{0.0, 0.0, 10.0, 10.0});
+
+      VERIFY(hasVertices(clipped, {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}),
+             caseLabel);
+   }
+   {
+      const std::string caseLabel = "internals::clipOutline for unbounded outline";
+
+      using Fp = double;
+
+      // Wedge that opens upwards from (5, 5).
+      internals::VoronoiOutline<Fp> outline;
+      outline.vertices = {{5.0, 5.0}};
+      outline.isUnbounded = true;
+      outline.startDir = Vec2<Fp>{-1.0, 1.0};
+      outline.endDir = Vec2<Fp>{1.0, 1.0};
+      const Poly2<Fp> clipped =
+         internals::clipOutline(outline, Rect<Fp>{0.0, 0.0, 10.0, 10.0});
+
+      VERIFY(hasVertices(clipped, {{5.0, 5.0}, {10.0, 10.0}, {0.0, 10.0}}), caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testVoronoiOutline()
+{
+   testClipPolygon();
+   testClipOutline();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for outlines of Voronoi tiles.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testVoronoiOutline();
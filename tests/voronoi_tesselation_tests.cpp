@@ -6,11 +6,15 @@
 // MIT license
 //
 #include "voronoi_tesselation_tests.h"
+#include "delauney_triangulation.h"
+#include "predicates.h"
 #include "test_util.h"
 #include "voronoi_tesselation.h"
 #include "voronoi_tile.h"
 #include "essentutils/fputil.h"
+#include "essentutils/rand_util.h"
 #include <algorithm>
+#include <utility>
 
 using namespace geom;
 using namespace sutil;
@@ -64,6 +68,49 @@ bool hasTiles(const std::vector<VoronoiTile<T>>& tess,
 }
 
 
+// Checks if a point is inside or on the outline of a convex tile.
+template <typename T> bool isInside(const VoronoiTile<T>& t, const Point2<T>& pt)
+{
+   const Poly2<T>& outline = t.outline();
+   bool hasLeft = false;
+   bool hasRight = false;
+   for (std::size_t i = 0; i < outline.size(); ++i)
+   {
+      const double side = orient2d(outline[i], outline[(i + 1) % outline.size()], pt);
+      hasLeft = hasLeft || side > 0.0;
+      hasRight = hasRight || side < 0.0;
+   }
+   return !(hasLeft && hasRight);
+}
+
+
+// Checks if two tesselations have tiles with the same seeds and areas. Avoids
+// depending on the order of the tiles.
+template <typename T>
+bool haveSameTiles(std::vector<VoronoiTile<T>> a, std::vector<VoronoiTile<T>> b)
+{
+   if (a.size() != b.size())
+      return false;
+
+   const auto isLess = [](const VoronoiTile<T>& x, const VoronoiTile<T>& y) {
+      return std::make_pair(x.seed().x(), x.seed().y()) <
+             std::make_pair(y.seed().x(), y.seed().y());
+   };
+   std::sort(a.begin(), a.end(), isLess);
+   std::sort(b.begin(), b.end(), isLess);
+
+   for (std::size_t i = 0; i < a.size(); ++i)
+   {
+      if (a[i].seed() != b[i].seed() || a[i].size() != b[i].size() ||
+          !fpEqual(calcArea(a[i]), calcArea(b[i]), 1e-6))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
 ///////////////////
 
 void testForNoPoints()
@@ -219,6 +266,21 @@ void testForThreePoints()
           {-3.0, 5.0}}};
       VERIFY(hasTiles(tiles, expected), caseLabel);
    }
+   {
+      const std::string caseLabel = "VoronoiTesselation for three collinear points";
+
+      using Fp = double;
+
+      // Collinear points are not tesselated.
+      const Rect<Fp> border{0.0, 0.0, 10.0, 10.0};
+      for (const auto algorithm :
+           {VoronoiAlgorithm::DelauneyDual, VoronoiAlgorithm::Fortune})
+      {
+         VoronoiTesselation<Fp> vt({{1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}}, border,
+                                   algorithm);
+         VERIFY(vt.tesselate().empty(), caseLabel);
+      }
+   }
 }
 
 
@@ -425,6 +487,39 @@ void testForMorePoints()
           {10.0, 27.367647058823}}};
       VERIFY(hasTiles(tiles, expected), caseLabel);
    }
+   {
+      const std::string caseLabel = "VoronoiTesselation for many collinear points";
+
+      using Fp = double;
+
+      std::vector<Point2<Fp>> diagonal;
+      std::vector<Point2<Fp>> horizontal;
+      std::vector<Point2<Fp>> vertical;
+      for (std::size_t i = 0; i < 100; ++i)
+      {
+         const Fp pos = static_cast<Fp>(i);
+         diagonal.emplace_back(pos, pos);
+         horizontal.emplace_back(pos, 50.0);
+         vertical.emplace_back(50.0, pos);
+      }
+
+      // Collinear points are not tesselated, regardless of the engine and the
+      // number of threads.
+      const Rect<Fp> border{0.0, 0.0, 100.0, 100.0};
+      for (const auto& samples : {diagonal, horizontal, vertical})
+      {
+         for (const auto algorithm :
+              {VoronoiAlgorithm::DelauneyDual, VoronoiAlgorithm::Fortune})
+         {
+            for (const std::size_t numThreads : {1, 4})
+            {
+               VoronoiTesselation<Fp> vt{samples, border, algorithm, numThreads};
+               VERIFY(vt.tesselate().empty(), caseLabel);
+               VERIFY(vt.getTriangulation().empty(), caseLabel);
+            }
+         }
+      }
+   }
 }
 
 
@@ -653,6 +748,141 @@ void testForPointsWithDecimals()
    }
 }
 
+
+void testForManyPoints()
+{
+   {
+      const std::string caseLabel = "VoronoiTesselation for many points";
+
+      using Fp = double;
+
+      Random<Fp> rand{1.0, 99.0, 1234};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 2000; ++i)
+      {
+         const Fp x = rand.next();
+         samples.emplace_back(x, rand.next());
+      }
+
+      const Rect<Fp> border{0.0, 0.0, 100.0, 100.0};
+      VoronoiTesselation<Fp> vt(samples, border);
+      const std::vector<VoronoiTile<Fp>> tiles = vt.tesselate();
+
+      VERIFY(tiles.size() == samples.size(), caseLabel);
+      // The tiles cover the area inside the border without overlapping.
+      double area = 0.0;
+      for (const auto& tile : tiles)
+         area += calcArea(tile);
+      VERIFY(fpEqual(area, 10000.0, 1e-6), caseLabel);
+      // Each tile belongs to one of the samples and contains it.
+      for (const auto& tile : tiles)
+      {
+         VERIFY(std::find(samples.begin(), samples.end(), tile.seed()) != samples.end(),
+                caseLabel);
+         VERIFY(isInside(tile, tile.seed()), caseLabel);
+      }
+   }
+}
+
+
+void testForLargeCoordinates()
+{
+   {
+      const std::string caseLabel = "VoronoiTesselation for large coordinates";
+
+      using Fp = double;
+
+      // Coordinates in the millions like projected map coordinates. Hull tiles
+      // reach far beyond any fixed distance.
+      const Rect<Fp> border{3.0e6, 5.0e6, 8.0e6, 10.0e6};
+      Random<Fp> rand{0.0, 5.0e6, 1234};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 2000; ++i)
+      {
+         const Fp x = border.left() + rand.next();
+         samples.emplace_back(x, border.top() + rand.next());
+      }
+
+      for (const auto algorithm :
+           {VoronoiAlgorithm::DelauneyDual, VoronoiAlgorithm::Fortune})
+      {
+         VoronoiTesselation<Fp> vt(samples, border, algorithm);
+         const std::vector<VoronoiTile<Fp>> tiles = vt.tesselate();
+
+         VERIFY(tiles.size() == samples.size(), caseLabel);
+         double area = 0.0;
+         for (const auto& tile : tiles)
+            area += calcArea(tile);
+         VERIFY(fpEqual(area / (border.width() * border.height()), 1.0, 1e-9), caseLabel);
+      }
+   }
+}
+
+
+void testForMultipleThreads()
+{
+   {
+      const std::string caseLabel = "VoronoiTesselation with multiple threads";
+
+      using Fp = double;
+
+      Random<Fp> rand{0.0, 1000.0, 2345};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 20000; ++i)
+      {
+         const Fp x = rand.next();
+         samples.emplace_back(x, rand.next());
+      }
+
+      const Rect<Fp> border{0.0, 0.0, 1000.0, 1000.0};
+      const std::vector<VoronoiTile<Fp>> serial =
+         VoronoiTesselation<Fp>{samples, border, VoronoiAlgorithm::Fortune, 1}
+            .tesselate();
+      const std::vector<VoronoiTile<Fp>> parallel =
+         VoronoiTesselation<Fp>{samples, border, VoronoiAlgorithm::Fortune, 4}
+            .tesselate();
+
+      // Same tiles in the same order.
+      bool isSame = parallel.size() == serial.size();
+      for (std::size_t i = 0; isSame && i < serial.size(); ++i)
+      {
+         isSame = parallel[i].seed() == serial[i].seed() &&
+                  parallel[i].outline() == serial[i].outline();
+      }
+      VERIFY(serial.size() == samples.size(), caseLabel);
+      VERIFY(isSame, caseLabel);
+   }
+   {
+      const std::string caseLabel =
+         "VoronoiTesselation with multiple threads for Delauney dual";
+
+      using Fp = double;
+
+      Random<Fp> rand{0.0, 1000.0, 2345};
+      std::vector<Point2<Fp>> samples;
+      for (std::size_t i = 0; i < 20000; ++i)
+      {
+         const Fp x = rand.next();
+         samples.emplace_back(x, rand.next());
+      }
+
+      // The parallel triangulation orders the vertices and with them the tiles
+      // differently.
+      const Rect<Fp> border{0.0, 0.0, 1000.0, 1000.0};
+      VoronoiTesselation<Fp> parallel{samples, border, VoronoiAlgorithm::DelauneyDual,
+                                      4};
+      const std::vector<VoronoiTile<Fp>> serialTiles =
+         VoronoiTesselation<Fp>{samples, border}.tesselate();
+      const std::vector<VoronoiTile<Fp>> parallelTiles = parallel.tesselate();
+
+      VERIFY(parallelTiles.size() == samples.size(), caseLabel);
+      VERIFY(haveSameTiles(serialTiles, parallelTiles), caseLabel);
+      VERIFY(parallel.getTriangulation().size() ==
+                DelauneyTriangulation<Fp>{samples}.triangulate().size(),
+             caseLabel);
+   }
+}
+
 } // namespace
 
 
@@ -668,4 +898,7 @@ void testVoronoiTesselation()
    testForRect();
    testWhenBorderIsMuchSmallerThanBoundingBox();
    testForPointsWithDecimals();
+   testForManyPoints();
+   testForLargeCoordinates();
+   testForMultipleThreads();
 }
@@ -0,0 +1,239 @@
+//
+// geomcpp tests
+// Tests for queries for the Voronoi tile that owns a point.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#include "voronoi_tile_locator_tests.h"
+#include "point2.h"
+#include "poly2.h"
+#include "predicates.h"
+#include "rect.h"
+#include "test_util.h"
+#include "voronoi_tesselation.h"
+#include "voronoi_tile.h"
+#include "voronoi_tile_locator.h"
+#include <string>
+#include <vector>
+
+using namespace geom;
+
+
+namespace
+{
+///////////////////
+
+template <typename T> using Locator = VoronoiTileLocator<T>;
+
+
+template <typename T>
+T distSquared(const Point2<T>& a, const Point2<T>& b)
+{
+   const T dx = a.x() - b.x();
+   const T dy = a.y() - b.y();
+   return dx * dx + dy * dy;
+}
+
+
+// Checks that the seed of a given tile is as close to a given point as any
+// other seed.
+template <typename T>
+bool isOwningTile(const std::vector<VoronoiTile<T>>& tiles, typename Locator<T>::Idx idx,
+                  const Point2<T>& pt)
+{
+   if (idx >= tiles.size())
+      return false;
+
+   const T dist = distSquared(tiles[idx].seed(), pt);
+   for (const auto& tile : tiles)
+      if (distSquared(tile.seed(), pt) < dist)
+         return false;
+   return true;
+}
+
+
+// Checks if a point is inside or on the outline of a convex tile.
+template <typename T> bool isInside(const VoronoiTile<T>& tile, const Point2<T>& pt)
+{
+   const Poly2<T>& outline = tile.outline();
+   bool hasLeft = false;
+   bool hasRight = false;
+   for (std::size_t i = 0; i < outline.size(); ++i)
+   {
+      const double side = orient2d(outline[i], outline[(i + 1) % outline.size()], pt);
+      hasLeft = hasLeft || side > 0.0;
+      hasRight = hasRight || side < 0.0;
+   }
+   return !(hasLeft && hasRight);
+}
+
+
+///////////////////
+
+void testFindTile()
+{
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTile";
+
+      using Fp = double;
+
+      const Rect<Fp> border{0.0, 0.0, 100.0, 100.0};
+      for (const auto algorithm :
+           {VoronoiAlgorithm::DelauneyDual, VoronoiAlgorithm::Fortune})
+      {
+         const std::vector<VoronoiTile<Fp>> tiles =
+            VoronoiTesselation<Fp>{makeRandomPoints<Fp>(1000, 1111, 0.0, 100.0), border,
+                                   algorithm}
+               .tesselate();
+         const Locator<Fp> locator{tiles};
+
+         bool isCorrect = true;
+         for (const auto& pt : makeRandomPoints<Fp>(500, 2222, 0.0, 100.0))
+         {
+            const auto idx = locator.findTile(pt);
+            isCorrect = isCorrect && isOwningTile(tiles, idx, pt) &&
+                        isInside(tiles[idx], pt);
+         }
+         VERIFY(isCorrect, caseLabel);
+      }
+   }
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTile outside of border";
+
+      using Fp = double;
+
+      const std::vector<VoronoiTile<Fp>> tiles =
+         VoronoiTesselation<Fp>{makeRandomPoints<Fp>(300, 3333, 0.0, 100.0),
+                                Rect<Fp>{0.0, 0.0, 100.0, 100.0}}
+            .tesselate();
+      const Locator<Fp> locator{tiles};
+
+      bool isCorrect = true;
+      for (const auto& pt : makeRandomPoints<Fp>(500, 4444, -100.0, 200.0))
+         isCorrect = isCorrect && isOwningTile(tiles, locator.findTile(pt), pt);
+      VERIFY(isCorrect, caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTile for seeds";
+
+      using Fp = float;
+
+      const std::vector<VoronoiTile<Fp>> tiles =
+         VoronoiTesselation<Fp>{makeRandomPoints<Fp>(200, 5555, 0.0f, 10.0f)}.tesselate();
+      const Locator<Fp> locator{tiles};
+
+      bool isCorrect = true;
+      for (std::size_t i = 0; i < tiles.size(); ++i)
+         isCorrect = isCorrect && locator.findTile(tiles[i].seed()) == i;
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+
+void testDegenerateTiles()
+{
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTile without tiles";
+
+      using Fp = double;
+
+      const Locator<Fp> locator{{}};
+
+      VERIFY(locator.findTile({1.0, 2.0}) == Locator<Fp>::NoIdx, caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTile for two tiles";
+
+      using Fp = double;
+
+      const std::vector<VoronoiTile<Fp>> tiles =
+         VoronoiTesselation<Fp>{{{2.0, 5.0}, {6.0, 5.0}}, Rect<Fp>{0.0, 0.0, 10.0, 10.0}}
+            .tesselate();
+      const Locator<Fp> locator{tiles};
+
+      VERIFY(isOwningTile(tiles, locator.findTile({1.0, 1.0}), {1.0, 1.0}), caseLabel);
+      VERIFY(isOwningTile(tiles, locator.findTile({9.0, 9.0}), {9.0, 9.0}), caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTiles for collinear seeds";
+
+      using Fp = double;
+
+      // Tesselations don't make tiles for collinear seeds. Only the seeds matter
+      // to the locator.
+      std::vector<VoronoiTile<Fp>> tiles;
+      for (int i = 0; i < 10; ++i)
+         tiles.emplace_back(Point2<Fp>(i, i), Poly2<Fp>{});
+      const Locator<Fp> locator{tiles};
+
+      const std::vector<Point2<Fp>> points = makeRandomPoints<Fp>(100, 6666, 0.0, 10.0);
+      std::vector<Locator<Fp>::Idx> result;
+      locator.findTiles(points, result);
+
+      bool isCorrect = result.size() == points.size();
+      for (std::size_t i = 0; i < points.size() && isCorrect; ++i)
+         isCorrect = isOwningTile(tiles, result[i], points[i]);
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+
+void testFindTiles()
+{
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTiles";
+
+      using Fp = double;
+
+      const std::vector<VoronoiTile<Fp>> tiles =
+         VoronoiTesselation<Fp>{makeRandomPoints<Fp>(1000, 7777, 0.0, 100.0),
+                                Rect<Fp>{0.0, 0.0, 100.0, 100.0}}
+            .tesselate();
+      const Locator<Fp> locator{tiles};
+      const std::vector<Point2<Fp>> points =
+         makeRandomPoints<Fp>(500, 8888, -20.0, 120.0);
+
+      std::vector<Locator<Fp>::Idx> result;
+      locator.findTiles(points, result);
+
+      bool isCorrect = result.size() == points.size();
+      for (std::size_t i = 0; i < points.size() && isCorrect; ++i)
+         isCorrect = isOwningTile(tiles, result[i], points[i]);
+      VERIFY(isCorrect, caseLabel);
+   }
+   {
+      const std::string caseLabel = "VoronoiTileLocator::findTiles with multiple threads";
+
+      using Fp = double;
+
+      const std::vector<VoronoiTile<Fp>> tiles =
+         VoronoiTesselation<Fp>{makeRandomPoints<Fp>(2000, 9999, 0.0, 100.0),
+                                Rect<Fp>{0.0, 0.0, 100.0, 100.0}}
+            .tesselate();
+      const Locator<Fp> locator{tiles};
+      const std::vector<Point2<Fp>> points =
+         makeRandomPoints<Fp>(50000, 1234, 0.0, 100.0);
+
+      std::vector<Locator<Fp>::Idx> serial;
+      locator.findTiles(points, serial, 1);
+      std::vector<Locator<Fp>::Idx> parallel;
+      locator.findTiles(points, parallel, 4);
+
+      VERIFY(parallel == serial, caseLabel);
+      bool isCorrect = true;
+      for (std::size_t i = 0; i < points.size() && isCorrect; i += 97)
+         isCorrect = isOwningTile(tiles, parallel[i], points[i]);
+      VERIFY(isCorrect, caseLabel);
+   }
+}
+
+} // namespace
+
+
+void testVoronoiTileLocator()
+{
+   testFindTile();
+   testDegenerateTiles();
+   testFindTiles();
+}
@@ -0,0 +1,10 @@
+//
+// geomcpp tests
+// Tests for queries for the Voronoi tile that owns a point.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+
+void testVoronoiTileLocator();
@@ -11,6 +11,7 @@
 #include "line_intersection2_ct.h"
 #include "line_seg2_ct.h"
 #include "point2.h"
+#include "predicates.h"
 #include "vec2.h"
 #include <array>
 #include <optional>
@@ -70,7 +71,8 @@ template <typename T> class Triangle
 template <typename T>
 Triangle<T>::Triangle(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c)
 {
-   const bool isCcw = ccw(Vec2<T>{a, b}, Vec2<T>{b, c});
+   // Ccw in the screen coordinate system is cw in the cartesian system.
+   const bool isCcw = orient2d(a, b, c) < 0;
    m_vertices[0] = a;
    m_vertices[1] = isCcw ? b : c;
    m_vertices[2] = isCcw ? c : b;
@@ -80,7 +82,8 @@ Triangle<T>::Triangle(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c
 template <typename T>
 Triangle<T>::Triangle(Point2<T>&& a, Point2<T>&& b, Point2<T>&& c)
 {
-   const bool isCcw = ccw(Vec2<T>{a, b}, Vec2<T>{b, c});
+   // Ccw in the screen coordinate system is cw in the cartesian system.
+   const bool isCcw = orient2d(a, b, c) < 0;
    m_vertices[0] = std::move(a);
    m_vertices[1] = isCcw ? std::move(b) : std::move(c);
    m_vertices[2] = isCcw ? std::move(c) : std::move(b);
@@ -123,8 +126,8 @@ template <typename T> bool Triangle<T>::isLine() const
 {
    if (isPoint())
       return false;
-   const ct::LineSeg2<T> side01(m_vertices[0], m_vertices[1]);
-   return m_vertices[0] == m_vertices[1] || side01.isPointOnInfiniteLine(m_vertices[2]);
+   return m_vertices[0] == m_vertices[1] ||
+          orient2d(m_vertices[0], m_vertices[1], m_vertices[2]) == 0;
 }
 
 
@@ -8,6 +8,7 @@
 #pragma once
 #include "geom_types.h"
 #include "point2.h"
+#include "predicates.h"
 #include "essentutils/fputil.h"
 #include <stdexcept>
 #include <type_traits>
@@ -202,6 +203,21 @@ std::common_type_t<typename Vec2<T>::Fp, typename Vec2<U>::Fp> perpDot(const Vec
 }
 
 
+// Calculates the perp dot product with a sign that is exact for the given
+// vector components. The magnitude is approximate. Vectors that are differences
+// of points are usually rounded already, so to decide the orientation of points
+// use orient2d on the points directly.
+template <typename T, typename U>
+PredicateFp<std::common_type_t<T, U>> robustPerpDot(const Vec2<T>& a, const Vec2<U>& b)
+{
+   using R = std::common_type_t<T, U>;
+   // The orientation of the vectors' end points relative to the origin.
+   return orient2d(Point2<R>{R(0), R(0)},
+                   Point2<R>{static_cast<R>(a.x()), static_cast<R>(a.y())},
+                   Point2<R>{static_cast<R>(b.x()), static_cast<R>(b.y())});
+}
+
+
 // Vector subtraction.
 template <typename T, typename U>
 Vec2<std::common_type_t<T, U>> operator-(const Vec2<T>& a, const Vec2<U>& b)
@@ -296,10 +312,9 @@ template <typename T, typename U> bool obtuseAngle(const Vec2<T>& v, const Vec2<
 template <typename T, typename U>
 bool ccw(const Vec2<T>& v, const Vec2<U>& w, CoordSys cs = CoordSys::Screen)
 {
-   using Fp = std::common_type_t<typename Vec2<T>::Fp, typename Vec2<U>::Fp>;
    if (cs == CoordSys::Screen)
-      return sutil::less<Fp>(perpDot(v, w), Fp(0));
-   return sutil::greater<Fp>(perpDot(v, w), Fp(0));
+      return robustPerpDot(v, w) < 0;
+   return robustPerpDot(v, w) > 0;
 }
 
 
@@ -308,10 +323,9 @@ bool ccw(const Vec2<T>& v, const Vec2<U>& w, CoordSys cs = CoordSys::Screen)
 template <typename T, typename U>
 bool cw(const Vec2<T>& v, const Vec2<U>& w, CoordSys cs = CoordSys::Screen)
 {
-   using Fp = std::common_type_t<typename Vec2<T>::Fp, typename Vec2<U>::Fp>;
    if (cs == CoordSys::Screen)
-      return sutil::greater<Fp>(perpDot(v, w), Fp(0));
-   return sutil::less<Fp>(perpDot(v, w), Fp(0));
+      return robustPerpDot(v, w) > 0;
+   return robustPerpDot(v, w) < 0;
 }
 
 
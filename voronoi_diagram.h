@@ -0,0 +1,603 @@
+//
+// geomcpp
+// Voronoi diagram stored as vertex, edge and cell buffers.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include "poly2.h"
+#include "predicates.h"
+#include "rect.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Voronoi diagram that stores each vertex once and references sites, vertices
+// and edges by 32-bit indices. Compact alternative to a list of tiles that
+// repeats each shared vertex for every tile it belongs to. The edges know the
+// sites on both of their sides, so neighboring cells can be found directly.
+// The diagram is clipped by a border. Edges along the border have a site only
+// on their inner side.
+template <typename T> struct VoronoiDiagram
+{
+   // Marks the missing site on the outer side of an edge along the border.
+   static constexpr std::uint32_t NoSite = std::numeric_limits<std::uint32_t>::max();
+
+   // Edge between the cells of two sites. The left site is on the left when
+   // going from the start to the end of the edge (cartesian coordinate system).
+   struct Edge
+   {
+      std::uint32_t from = 0;
+      std::uint32_t to = 0;
+      std::uint32_t left = NoSite;
+      std::uint32_t right = NoSite;
+   };
+
+   std::size_t numCells() const { return sites.size(); }
+   // Returns the site on the other side of a given edge of the cell of a given
+   // site.
+   std::uint32_t neighbor(std::uint32_t edge, std::uint32_t site) const;
+   // Returns the outline of the cell of a given site in ccw order (cartesian
+   // coordinate system). Empty for cells that are outside of the border.
+   Poly2<T> cellOutline(std::uint32_t site) const;
+
+   // Sites of the cells.
+   std::vector<Point2<T>> sites;
+   // Vertices of the diagram that are within the border, the points where the
+   // border clips edges, and the corners of the border.
+   std::vector<Point2<T>> vertices;
+   std::vector<Edge> edges;
+   // Edges of the cells in ccw order. The edges of the cell of site i are stored
+   // in the range [firstCellEdge[i], firstCellEdge[i + 1]).
+   std::vector<std::uint32_t> firstCellEdge;
+   std::vector<std::uint32_t> cellEdges;
+};
+
+
+template <typename T>
+std::uint32_t VoronoiDiagram<T>::neighbor(std::uint32_t edge, std::uint32_t site) const
+{
+   const Edge& e = edges[edge];
+   return e.left == site ? e.right : e.left;
+}
+
+
+template <typename T> Poly2<T> VoronoiDiagram<T>::cellOutline(std::uint32_t site) const
+{
+   Poly2<T> outline;
+   for (std::uint32_t i = firstCellEdge[site]; i < firstCellEdge[site + 1]; ++i)
+   {
+      const Edge& e = edges[cellEdges[i]];
+      outline.add(vertices[e.left == site ? e.from : e.to]);
+   }
+   return outline;
+}
+
+
+namespace internals
+{
+///////////////////
+
+// Edge of a Voronoi diagram before it is clipped. Separates the tiles of a left
+// and a right site. The edge runs from ends[0] to ends[1] in the direction of
+// the cw normal of the vector from the left to the right site (cartesian
+// coordinate system). Ends that are NoIdx extend to infinity.
+struct VoronoiEdge
+{
+   static constexpr std::uint32_t NoIdx = std::numeric_limits<std::uint32_t>::max();
+
+   std::uint32_t left = NoIdx;
+   std::uint32_t right = NoIdx;
+   std::uint32_t ends[2] = {NoIdx, NoIdx};
+};
+
+
+///////////////////
+
+// Clips the edges of a Voronoi diagram by a border and collects the edges of
+// each cell.
+// - Vertices that are joined by edges of zero length are merged, so sites that
+//   share a circle share a single vertex.
+// - Edges are clipped with the Liang-Barsky algorithm. The clip points are
+//   shared by the two cells of an edge.
+// - The clipped edges of each cell form closed loops or chains that start and
+//   end on the border. Chains are connected along the border in ccw order,
+//   adding the corners of the border that are passed.
+template <typename T> class VoronoiDiagramBuilder
+{
+ public:
+   static VoronoiDiagram<T> build(const std::vector<Point2<T>>& sites,
+                                  const std::vector<Point2<T>>& vertices,
+                                  const std::vector<VoronoiEdge>& edges,
+                                  const Rect<T>& border);
+
+ private:
+   using Fp = PredicateFp<T>;
+   using Idx = std::uint32_t;
+   static constexpr Idx NoIdx = VoronoiEdge::NoIdx;
+
+   // Edge as seen from one of its cells, i.e. in ccw order around the cell.
+   struct HalfEdge
+   {
+      Idx from = 0;
+      Idx to = 0;
+      Idx edge = 0;
+   };
+
+   // Edges of a cell that connect one border point to another.
+   struct Chain
+   {
+      std::size_t first = 0;
+      std::size_t last = 0;
+      Fp entryPos = 0;
+   };
+
+   VoronoiDiagramBuilder(const std::vector<Point2<T>>& sites,
+                         const std::vector<Point2<T>>& vertices, const Rect<T>& border);
+
+   void mergeVertices(const std::vector<VoronoiEdge>& edges);
+   Idx findMerged(Idx vertex);
+   void clipEdges(const std::vector<VoronoiEdge>& edges);
+   // Clips the line through a given point in a given direction to the parameter
+   // range [t0, t1]. Returns false if nothing of it is inside the border.
+   bool clipLine(Fp px, Fp py, Fp dx, Fp dy, Fp& t0, Fp& t1) const;
+   void collectCells();
+   // Appends the edges of the cell of a given site in ccw order.
+   void collectCell(Idx site, std::vector<HalfEdge>& halfEdges);
+   // Appends edges along the border from one border point ccw to another.
+   void addBorderEdges(Idx site, Idx from, Idx to);
+   // Gives the entire border to the cell of the site that is closest to it.
+   void collectSingleCell();
+
+   // Returns the output vertex of a given input vertex.
+   Idx outputVertex(Idx vertex);
+   Idx addVertex(Fp x, Fp y);
+   Idx cornerVertex(std::size_t corner);
+   // Returns the distance of a point on the border from the left-bottom corner
+   // measured ccw along the border (cartesian coordinate system).
+   Fp perimeterPos(const Point2<T>& pt) const;
+
+ private:
+   const std::vector<Point2<T>>& m_vertices;
+   VoronoiDiagram<T> m_diagram;
+   // Border in cartesian terms.
+   Fp m_left = 0;
+   Fp m_bottom = 0;
+   Fp m_right = 0;
+   Fp m_top = 0;
+   // Input vertices that are merged with an other vertex.
+   std::vector<Idx> m_merged;
+   // Output vertex of each input vertex or NoIdx if it is not used.
+   std::vector<Idx> m_outputVertices;
+   std::size_t m_numClipPoints = 0;
+   // Output vertices of the corners of the border in ccw order starting at the
+   // left-bottom corner.
+   std::array<Idx, 4> m_corners = {NoIdx, NoIdx, NoIdx, NoIdx};
+   // For each site the clipped edges that it is on.
+   std::vector<Idx> m_firstSiteEdge;
+   std::vector<Idx> m_siteEdges;
+};
+
+
+template <typename T>
+VoronoiDiagram<T> VoronoiDiagramBuilder<T>::build(const std::vector<Point2<T>>& sites,
+                                                  const std::vector<Point2<T>>& vertices,
+                                                  const std::vector<VoronoiEdge>& edges,
+                                                  const Rect<T>& border)
+{
+   VoronoiDiagramBuilder builder{sites, vertices, border};
+   builder.mergeVertices(edges);
+   builder.clipEdges(edges);
+   if (builder.m_diagram.edges.empty())
+      builder.collectSingleCell();
+   else
+      builder.collectCells();
+   // Vertices outside of the border are dropped and clip points are added, so
+   // the reserved memory is off.
+   builder.m_diagram.vertices.shrink_to_fit();
+   return std::move(builder.m_diagram);
+}
+
+
+template <typename T>
+VoronoiDiagramBuilder<T>::VoronoiDiagramBuilder(const std::vector<Point2<T>>& sites,
+                                                const std::vector<Point2<T>>& vertices,
+                                                const Rect<T>& border)
+: m_vertices{vertices}, m_left{Fp(border.left())}, m_bottom{Fp(border.top())},
+  m_right{Fp(border.right())}, m_top{Fp(border.bottom())}
+{
+   m_diagram.sites = sites;
+   if (m_left > m_right)
+      std::swap(m_left, m_right);
+   if (m_bottom > m_top)
+      std::swap(m_bottom, m_top);
+}
+
+
+template <typename T>
+void VoronoiDiagramBuilder<T>::mergeVertices(const std::vector<VoronoiEdge>& edges)
+{
+   m_merged.resize(m_vertices.size());
+   for (Idx i = 0; i < m_merged.size(); ++i)
+      m_merged[i] = i;
+
+   for (const VoronoiEdge& e : edges)
+   {
+      if (e.ends[0] == NoIdx || e.ends[1] == NoIdx ||
+          m_vertices[e.ends[0]] != m_vertices[e.ends[1]])
+         continue;
+
+      const Idx a = findMerged(e.ends[0]);
+      const Idx b = findMerged(e.ends[1]);
+      // Merge into the smaller index to keep the result independent of the
+      // order of the edges.
+      m_merged[std::max(a, b)] = std::min(a, b);
+   }
+}
+
+
+template <typename T>
+typename VoronoiDiagramBuilder<T>::Idx VoronoiDiagramBuilder<T>::findMerged(Idx vertex)
+{
+   while (m_merged[vertex] != vertex)
+   {
+      m_merged[vertex] = m_merged[m_merged[vertex]];
+      vertex = m_merged[vertex];
+   }
+   return vertex;
+}
+
+
+template <typename T>
+void VoronoiDiagramBuilder<T>::clipEdges(const std::vector<VoronoiEdge>& edges)
+{
+   const std::vector<Point2<T>>& sites = m_diagram.sites;
+   m_outputVertices.assign(m_vertices.size(), NoIdx);
+   m_diagram.edges.reserve(edges.size());
+   m_diagram.vertices.reserve(m_vertices.size());
+   constexpr Fp Inf = std::numeric_limits<Fp>::infinity();
+
+   for (const VoronoiEdge& e : edges)
+   {
+      Idx ends[2] = {e.ends[0] == NoIdx ? NoIdx : findMerged(e.ends[0]),
+                     e.ends[1] == NoIdx ? NoIdx : findMerged(e.ends[1])};
+      if (ends[0] != NoIdx && ends[0] == ends[1])
+         continue;
+
+      const Point2<T>& l = sites[e.left];
+      const Point2<T>& r = sites[e.right];
+      const Fp dx = Fp(r.y()) - Fp(l.y());
+      const Fp dy = Fp(l.x()) - Fp(r.x());
+
+      // Parametrize the edge from a finite end if it has one.
+      Fp px = (Fp(l.x()) + Fp(r.x())) / Fp(2);
+      Fp py = (Fp(l.y()) + Fp(r.y())) / Fp(2);
+      Fp tEnds[2] = {-Inf, Inf};
+      for (std::size_t i = 0; i < 2; ++i)
+      {
+         if (ends[i] != NoIdx)
+         {
+            px = Fp(m_vertices[ends[i]].x());
+            py = Fp(m_vertices[ends[i]].y());
+            tEnds[i] = Fp(0);
+            break;
+         }
+      }
+      if (ends[0] != NoIdx && ends[1] != NoIdx)
+      {
+         const Point2<T>& v = m_vertices[ends[1]];
+         tEnds[1] = ((Fp(v.x()) - px) * dx + (Fp(v.y()) - py) * dy) / (dx * dx + dy * dy);
+      }
+
+      Fp t[2] = {tEnds[0], tEnds[1]};
+      if (!clipLine(px, py, dx, dy, t[0], t[1]))
+         continue;
+
+      Idx clipped[2] = {NoIdx, NoIdx};
+      for (std::size_t i = 0; i < 2; ++i)
+      {
+         if (ends[i] != NoIdx && t[i] == tEnds[i])
+         {
+            clipped[i] = outputVertex(ends[i]);
+         }
+         else
+         {
+            clipped[i] = addVertex(px + t[i] * dx, py + t[i] * dy);
+            ++m_numClipPoints;
+         }
+      }
+      // The edge runs against the direction of the unclipped edge, so that the
+      // left site is on its left.
+      m_diagram.edges.push_back({clipped[1], clipped[0], e.left, e.right});
+   }
+}
+
+
+template <typename T>
+bool VoronoiDiagramBuilder<T>::clipLine(Fp px, Fp py, Fp dx, Fp dy, Fp& t0, Fp& t1) const
+{
+   // For each side of the border the line is inside where p * t <= q.
+   const Fp p[4] = {-dx, dx, -dy, dy};
+   const Fp q[4] = {px - m_left, m_right - px, py - m_bottom, m_top - py};
+   for (std::size_t i = 0; i < 4; ++i)
+   {
+      if (p[i] == Fp(0))
+      {
+         if (q[i] < Fp(0))
+            return false;
+         continue;
+      }
+
+      const Fp t = q[i] / p[i];
+      if (p[i] < Fp(0))
+         t0 = std::max(t0, t);
+      else
+         t1 = std::min(t1, t);
+   }
+   return t0 < t1;
+}
+
+
+template <typename T> void VoronoiDiagramBuilder<T>::collectCells()
+{
+   // Distribute the edges to the sites on their sides.
+   const std::size_t numSites = m_diagram.sites.size();
+   const std::size_t numEdges = m_diagram.edges.size();
+   m_firstSiteEdge.assign(numSites + 1, 0);
+   for (const auto& e : m_diagram.edges)
+   {
+      ++m_firstSiteEdge[e.left + 1];
+      ++m_firstSiteEdge[e.right + 1];
+   }
+   for (std::size_t i = 1; i <= numSites; ++i)
+      m_firstSiteEdge[i] += m_firstSiteEdge[i - 1];
+
+   std::vector<Idx> pos{m_firstSiteEdge.begin(), m_firstSiteEdge.end() - 1};
+   m_siteEdges.resize(2 * numEdges);
+   for (Idx i = 0; i < numEdges; ++i)
+   {
+      m_siteEdges[pos[m_diagram.edges[i].left]++] = i;
+      m_siteEdges[pos[m_diagram.edges[i].right]++] = i;
+   }
+
+   // Each edge is used by two cells. Border edges are added to one cell. There
+   // is at most one for each clip point and corner.
+   const std::size_t maxBorderEdges = m_numClipPoints + 4;
+   m_diagram.edges.reserve(numEdges + maxBorderEdges);
+   m_diagram.firstCellEdge.reserve(numSites + 1);
+   m_diagram.cellEdges.reserve(2 * numEdges + maxBorderEdges);
+   std::vector<HalfEdge> halfEdges;
+   for (Idx site = 0; site < numSites; ++site)
+   {
+      m_diagram.firstCellEdge.push_back(static_cast<Idx>(m_diagram.cellEdges.size()));
+      collectCell(site, halfEdges);
+   }
+   m_diagram.firstCellEdge.push_back(static_cast<Idx>(m_diagram.cellEdges.size()));
+}
+
+
+template <typename T>
+void VoronoiDiagramBuilder<T>::collectCell(Idx site, std::vector<HalfEdge>& halfEdges)
+{
+   halfEdges.clear();
+   for (Idx i = m_firstSiteEdge[site]; i < m_firstSiteEdge[site + 1]; ++i)
+   {
+      const Idx edge = m_siteEdges[i];
+      const auto& e = m_diagram.edges[edge];
+      halfEdges.push_back(e.left == site ? HalfEdge{e.from, e.to, edge}
+                                         : HalfEdge{e.to, e.from, edge});
+   }
+   if (halfEdges.empty())
+      return;
+
+   // Look up the next half edge by its start vertex.
+   std::sort(halfEdges.begin(), halfEdges.end(),
+             [](const HalfEdge& a, const HalfEdge& b) { return a.from < b.from; });
+   const auto findNext = [&halfEdges](Idx vertex) {
+      const auto pos = std::lower_bound(
+         halfEdges.begin(), halfEdges.end(), vertex,
+         [](const HalfEdge& he, Idx v) { return he.from < v; });
+      return pos != halfEdges.end() && pos->from == vertex
+                ? static_cast<std::size_t>(pos - halfEdges.begin())
+                : halfEdges.size();
+   };
+
+   // Chains start at half edges that don't have a previous half edge.
+   std::vector<bool> hasPrev(halfEdges.size(), false);
+   for (const HalfEdge& he : halfEdges)
+   {
+      const std::size_t next = findNext(he.to);
+      if (next < halfEdges.size())
+         hasPrev[next] = true;
+   }
+
+   std::vector<Chain> chains;
+   for (std::size_t i = 0; i < halfEdges.size(); ++i)
+      if (!hasPrev[i])
+         chains.push_back({i, i, perimeterPos(m_diagram.vertices[halfEdges[i].from])});
+
+   // Cells inside the border are a single loop.
+   if (chains.empty())
+   {
+      std::size_t he = 0;
+      for (std::size_t n = 0; n < halfEdges.size(); ++n)
+      {
+         m_diagram.cellEdges.push_back(halfEdges[he].edge);
+         he = findNext(halfEdges[he].to);
+         if (he == 0 || he == halfEdges.size())
+            break;
+      }
+      return;
+   }
+
+   std::sort(chains.begin(), chains.end(),
+             [](const Chain& a, const Chain& b) { return a.entryPos < b.entryPos; });
+   for (std::size_t c = 0; c < chains.size(); ++c)
+   {
+      std::size_t he = chains[c].first;
+      for (std::size_t n = 0; n < halfEdges.size() && he < halfEdges.size(); ++n)
+      {
+         m_diagram.cellEdges.push_back(halfEdges[he].edge);
+         chains[c].last = he;
+         he = findNext(halfEdges[he].to);
+      }
+
+      const Chain& next = chains[(c + 1) % chains.size()];
+      addBorderEdges(site, halfEdges[chains[c].last].to, halfEdges[next.first].from);
+   }
+}
+
+
+template <typename T>
+void VoronoiDiagramBuilder<T>::addBorderEdges(Idx site, Idx from, Idx to)
+{
+   const Fp width = m_right - m_left;
+   const Fp height = m_top - m_bottom;
+   const Fp perimeter = Fp(2) * (width + height);
+   const Fp cornerPos[4] = {Fp(0), width, width + height, Fp(2) * width + height};
+
+   const Fp fromPos = perimeterPos(m_diagram.vertices[from]);
+   Fp dist = perimeterPos(m_diagram.vertices[to]) - fromPos;
+   if (dist < Fp(0))
+      dist += perimeter;
+
+   // Pass the corners between the points in ccw order.
+   std::array<std::pair<Fp, std::size_t>, 4> corners;
+   for (std::size_t i = 0; i < 4; ++i)
+   {
+      Fp cornerDist = cornerPos[i] - fromPos;
+      if (cornerDist < Fp(0))
+         cornerDist += perimeter;
+      corners[i] = {cornerDist, i};
+   }
+   std::sort(corners.begin(), corners.end());
+
+   Idx prev = from;
+   for (const auto& [cornerDist, corner] : corners)
+   {
+      if (cornerDist <= Fp(0) || cornerDist >= dist)
+         continue;
+      const Idx cornerIdx = cornerVertex(corner);
+      if (m_diagram.vertices[cornerIdx] == m_diagram.vertices[prev] ||
+          m_diagram.vertices[cornerIdx] == m_diagram.vertices[to])
+         continue;
+
+      m_diagram.cellEdges.push_back(static_cast<Idx>(m_diagram.edges.size()));
+      m_diagram.edges.push_back({prev, cornerIdx, site, VoronoiDiagram<T>::NoSite});
+      prev = cornerIdx;
+   }
+
+   if (prev != to && m_diagram.vertices[prev] != m_diagram.vertices[to])
+   {
+      m_diagram.cellEdges.push_back(static_cast<Idx>(m_diagram.edges.size()));
+      m_diagram.edges.push_back({prev, to, site, VoronoiDiagram<T>::NoSite});
+   }
+}
+
+
+template <typename T> void VoronoiDiagramBuilder<T>::collectSingleCell()
+{
+   const std::vector<Point2<T>>& sites = m_diagram.sites;
+   m_diagram.firstCellEdge.assign(sites.size() + 1, 0);
+   if (sites.empty())
+      return;
+
+   const Fp cx = (m_left + m_right) / Fp(2);
+   const Fp cy = (m_bottom + m_top) / Fp(2);
+   const auto distSquared = [cx, cy](const Point2<T>& pt) {
+      const Fp dx = Fp(pt.x()) - cx;
+      const Fp dy = Fp(pt.y()) - cy;
+      return dx * dx + dy * dy;
+   };
+   const auto closest = std::min_element(
+      sites.begin(), sites.end(), [&](const Point2<T>& a, const Point2<T>& b) {
+         return distSquared(a) < distSquared(b);
+      });
+   const Idx site = static_cast<Idx>(closest - sites.begin());
+
+   for (std::size_t i = 0; i < 4; ++i)
+   {
+      m_diagram.cellEdges.push_back(static_cast<Idx>(i));
+      m_diagram.edges.push_back(
+         {cornerVertex(i), cornerVertex((i + 1) % 4), site, VoronoiDiagram<T>::NoSite});
+   }
+   for (std::size_t i = site + 1; i <= sites.size(); ++i)
+      m_diagram.firstCellEdge[i] = 4;
+}
+
+
+template <typename T>
+typename VoronoiDiagramBuilder<T>::Idx VoronoiDiagramBuilder<T>::outputVertex(Idx vertex)
+{
+   if (m_outputVertices[vertex] == NoIdx)
+   {
+      m_outputVertices[vertex] = static_cast<Idx>(m_diagram.vertices.size());
+      m_diagram.vertices.push_back(m_vertices[vertex]);
+   }
+   return m_outputVertices[vertex];
+}
+
+
+template <typename T>
+typename VoronoiDiagramBuilder<T>::Idx VoronoiDiagramBuilder<T>::addVertex(Fp x, Fp y)
+{
+   // Keep clip points on the border despite rounding.
+   m_diagram.vertices.emplace_back(static_cast<T>(std::clamp(x, m_left, m_right)),
+                                   static_cast<T>(std::clamp(y, m_bottom, m_top)));
+   return static_cast<Idx>(m_diagram.vertices.size() - 1);
+}
+
+
+template <typename T>
+typename VoronoiDiagramBuilder<T>::Idx
+VoronoiDiagramBuilder<T>::cornerVertex(std::size_t corner)
+{
+   if (m_corners[corner] == NoIdx)
+   {
+      m_corners[corner] = addVertex(corner == 0 || corner == 3 ? m_left : m_right,
+                                    corner < 2 ? m_bottom : m_top);
+   }
+   return m_corners[corner];
+}
+
+
+template <typename T>
+typename VoronoiDiagramBuilder<T>::Fp
+VoronoiDiagramBuilder<T>::perimeterPos(const Point2<T>& pt) const
+{
+   const Fp x = pt.x();
+   const Fp y = pt.y();
+   const Fp width = m_right - m_left;
+   const Fp height = m_top - m_bottom;
+
+   // Measure along the closest side.
+   const Fp dists[4] = {std::abs(y - m_bottom), std::abs(x - m_right),
+                        std::abs(y - m_top), std::abs(x - m_left)};
+   const std::size_t side = std::min_element(dists, dists + 4) - dists;
+   switch (side)
+   {
+   case 0:
+      return x - m_left;
+   case 1:
+      return width + (y - m_bottom);
+   case 2:
+      return width + height + (m_right - x);
+   default:
+      return Fp(2) * width + height + (m_top - y);
+   }
+}
+
+} // namespace internals
+} // namespace geom
@@ -0,0 +1,610 @@
+//
+// geomcpp
+// Fortune's sweep line algorithm for Voronoi tesselations.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include "predicates.h"
+#include "rect.h"
+#include "vec2.h"
+#include "voronoi_diagram.h"
+#include "voronoi_outline.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <vector>
+
+
+namespace geom
+{
+namespace internals
+{
+///////////////////
+
+// Voronoi diagram calculated with Fortune's sweep line algorithm in
+// O(n log n) time.
+// A horizontal line sweeps down over the sites. The part of the diagram above
+// the line that can't change anymore is bounded by the beach line, a sequence
+// of parabolic arcs. Each arc belongs to the site that is closest to the
+// points of the arc. The breakpoints between neighboring arcs trace the edges
+// of the diagram.
+// - When the line reaches a site, the arc above the site is split and a new
+//   arc for the site is inserted between the parts.
+// - When an arc shrinks to a point, its neighbors meet at a vertex of the
+//   diagram. This happens when the line reaches the bottom of the circle
+//   through the sites of the arc and its neighbors (circle event).
+// The beach line is stored as a treap of arcs that are ordered from left to
+// right, so the arc above a site is found in O(log n) expected time. The arcs
+// are also linked to their neighbors. Circle events are kept in a priority
+// queue. Events of arcs that change before the event happens are invalidated
+// instead of being removed from the queue.
+// Whether a circle event exists is decided with the exact orientation
+// predicate. Breakpoints and circle centers are calculated in at least double
+// precision relative to the sites that are involved.
+// Source:
+// Fortune - A sweepline algorithm for Voronoi diagrams, Algorithmica, 1987
+template <typename T> class VoronoiFortune
+{
+ public:
+   static constexpr std::uint32_t NoIdx = std::numeric_limits<std::uint32_t>::max();
+
+   // Exact duplicate samples are ignored. If all samples are collinear, the
+   // diagram has no vertices and no tiles are built.
+   explicit VoronoiFortune(const std::vector<Point2<T>>& samples);
+
+   // Returns the number of sites that tiles can be built for. The sites are
+   // ordered from top to bottom.
+   std::size_t numSites() const { return m_vertices.empty() ? 0 : m_sites.size(); }
+   const Point2<T>& site(std::uint32_t idx) const { return m_sites[idx]; }
+   // Builds the outline of the tile of the site at a given index. Reuses the
+   // memory of the given outline.
+   void build(std::uint32_t site, VoronoiOutline<T>& outline) const;
+   // Builds the diagram of all sites clipped by a given border. Collinear sites
+   // are supported.
+   VoronoiDiagram<T> makeDiagram(const Rect<T>& border) const
+   {
+      return VoronoiDiagramBuilder<T>::build(m_sites, m_vertices, m_edges, border);
+   }
+
+ private:
+   using Fp = PredicateFp<T>;
+   using Idx = std::uint32_t;
+
+   // Arc of the beach line. Node of the treap.
+   struct Arc
+   {
+      Idx site = NoIdx;
+      Idx parent = NoIdx;
+      Idx left = NoIdx;
+      Idx right = NoIdx;
+      // Neighboring arcs on the beach line.
+      Idx prev = NoIdx;
+      Idx next = NoIdx;
+      // Treap priority. Parents have smaller priorities than their children.
+      std::uint32_t priority = 0;
+      // Id of the pending circle event for the arc or NoIdx.
+      Idx event = NoIdx;
+      // Edge that is traced by the breakpoint to the right of the arc and the
+      // end of the edge that the breakpoint moves to.
+      Idx rightEdge = NoIdx;
+      std::uint8_t rightEnd = 0;
+   };
+
+   // Circle event at which an arc disappears.
+   struct CircleEvent
+   {
+      // Position of the sweep line when the event happens.
+      Fp y = 0;
+      // Center of the circle, i.e. the new vertex.
+      Fp centerX = 0;
+      Fp centerY = 0;
+      Idx arc = NoIdx;
+      Idx id = NoIdx;
+
+      // Orders the events from top to bottom, then from left to right.
+      friend bool operator<(const CircleEvent& a, const CircleEvent& b)
+      {
+         return a.y < b.y || (a.y == b.y && a.centerX > b.centerX);
+      }
+   };
+
+   // Edge of the diagram between two sites. The breakpoint with the left site
+   // on its left and the right site on its right moves towards ends[1].
+   using Edge = VoronoiEdge;
+
+   void sweep();
+   // Adds a site that is level with the topmost site. There are no arcs above it
+   // yet.
+   void addTopSite(Idx site, Idx prevArc);
+   void handleSite(Idx site);
+   void handleCircle(const CircleEvent& event);
+   // Queues the circle event for an arc if its neighbors converge.
+   void addCircleEvent(Idx arc, Fp sweepY);
+   // Returns the arc above a given point on the sweep line.
+   Idx findArcAbove(const Point2<T>& pt) const;
+   // Returns the x-coordinate of the breakpoint between the arcs of two sites
+   // for a given position of the sweep line.
+   Fp calcBreakpoint(Idx leftSite, Idx rightSite, Fp sweepY) const;
+
+   Idx makeArc(Idx site);
+   // Inserts an arc into the beach line right after a given arc.
+   void insertAfter(Idx arc, Idx newArc);
+   void remove(Idx arc);
+   // Rotates an arc above its parent in the treap.
+   void rotateUp(Idx arc);
+
+   // Collects the edges of each site ordered ccw around it.
+   void collectSiteEdges();
+   // Returns the direction in which a given end of an edge moves away from the
+   // other end.
+   Vec2<T> endDirection(const Edge& edge, std::size_t end) const;
+
+ private:
+   // Sites ordered by decreasing y-coordinate, then by increasing x-coordinate.
+   std::vector<Point2<T>> m_sites;
+   std::vector<Point2<T>> m_vertices;
+   std::vector<Edge> m_edges;
+   // Edges of the sites in ccw order around them. The edges of site i are
+   // stored in the range [m_firstSiteEdge[i], m_firstSiteEdge[i + 1]).
+   std::vector<Idx> m_firstSiteEdge;
+   std::vector<Idx> m_siteEdges;
+
+   // Beach line.
+   std::vector<Arc> m_arcs;
+   std::vector<Idx> m_freeArcs;
+   Idx m_root = NoIdx;
+   std::uint32_t m_randState = 2463534242u;
+
+   std::priority_queue<CircleEvent> m_events;
+   Idx m_nextEventId = 0;
+};
+
+
+template <typename T>
+VoronoiFortune<T>::VoronoiFortune(const std::vector<Point2<T>>& samples)
+: m_sites{samples}
+{
+   std::sort(m_sites.begin(), m_sites.end(), [](const Point2<T>& a, const Point2<T>& b) {
+      return a.y() > b.y() || (a.y() == b.y() && a.x() < b.x());
+   });
+   m_sites.erase(std::unique(m_sites.begin(), m_sites.end(),
+                             [](const Point2<T>& a, const Point2<T>& b) {
+                                return a.x() == b.x() && a.y() == b.y();
+                             }),
+                 m_sites.end());
+
+   sweep();
+   collectSiteEdges();
+}
+
+
+template <typename T>
+void VoronoiFortune<T>::build(std::uint32_t site, VoronoiOutline<T>& outline) const
+{
+   outline.clear();
+   const Idx first = m_firstSiteEdge[site];
+   const std::size_t numEdges = m_firstSiteEdge[site + 1] - first;
+
+   // Walking ccw around the site, each edge leads from one end to the other.
+   // The site is left of its edges.
+   const auto fromEnd = [site](const Edge& e) -> std::size_t {
+      return e.left == site ? 1 : 0;
+   };
+
+   // Unbounded tiles start at the edge that comes in from infinity.
+   std::size_t start = 0;
+   for (std::size_t i = 0; i < numEdges; ++i)
+   {
+      const Edge& e = m_edges[m_siteEdges[first + i]];
+      if (e.ends[fromEnd(e)] == NoIdx)
+      {
+         start = i;
+         outline.isUnbounded = true;
+         outline.startDir = endDirection(e, fromEnd(e));
+         break;
+      }
+   }
+
+   std::vector<Point2<T>>& corners = outline.vertices;
+   for (std::size_t i = 0; i < numEdges; ++i)
+   {
+      const Edge& e = m_edges[m_siteEdges[first + (start + i) % numEdges]];
+      const std::size_t toEnd = 1 - fromEnd(e);
+      if (e.ends[toEnd] == NoIdx)
+      {
+         outline.endDir = endDirection(e, toEnd);
+         break;
+      }
+
+      // Zero length edges occur at vertices that more than three sites share.
+      const Point2<T>& corner = m_vertices[e.ends[toEnd]];
+      if (corners.empty() || corners.back() != corner)
+         corners.push_back(corner);
+   }
+
+   if (!outline.isUnbounded && corners.size() > 1 && corners.front() == corners.back())
+      corners.pop_back();
+}
+
+
+template <typename T> void VoronoiFortune<T>::sweep()
+{
+   if (m_sites.empty())
+      return;
+
+   m_arcs.reserve(2 * m_sites.size());
+   m_edges.reserve(3 * m_sites.size());
+   m_vertices.reserve(2 * m_sites.size());
+
+   m_root = makeArc(0);
+   Idx site = 1;
+   const T topY = m_sites[0].y();
+   for (Idx lastArc = m_root; site < m_sites.size() && m_sites[site].y() == topY; ++site)
+   {
+      addTopSite(site, lastArc);
+      lastArc = m_arcs[lastArc].next;
+   }
+
+   while (site < m_sites.size() || !m_events.empty())
+   {
+      // Circle events happen before sites at the same position of the sweep
+      // line.
+      if (!m_events.empty() &&
+          (site == m_sites.size() || m_events.top().y >= Fp(m_sites[site].y())))
+      {
+         const CircleEvent event = m_events.top();
+         m_events.pop();
+         if (m_arcs[event.arc].event == event.id)
+            handleCircle(event);
+      }
+      else
+      {
+         handleSite(site++);
+      }
+   }
+}
+
+
+template <typename T> void VoronoiFortune<T>::addTopSite(Idx site, Idx prevArc)
+{
+   // The edge between two top sites comes down vertically from infinity.
+   const Idx arc = makeArc(site);
+   m_edges.push_back(Edge{m_arcs[prevArc].site, site});
+   m_arcs[prevArc].rightEdge = static_cast<Idx>(m_edges.size() - 1);
+   m_arcs[prevArc].rightEnd = 1;
+   insertAfter(prevArc, arc);
+}
+
+
+template <typename T> void VoronoiFortune<T>::handleSite(Idx site)
+{
+   const Fp sweepY = m_sites[site].y();
+   const Idx arc = findArcAbove(m_sites[site]);
+   const Idx arcSite = m_arcs[arc].site;
+   m_arcs[arc].event = NoIdx;
+
+   // Split the arc and insert the new arc between its parts. The breakpoints on
+   // both sides of the new arc trace the same edge in opposite directions.
+   const Idx edge = static_cast<Idx>(m_edges.size());
+   m_edges.push_back(Edge{site, arcSite});
+   const Idx middle = makeArc(site);
+   const Idx right = makeArc(arcSite);
+   m_arcs[right].rightEdge = m_arcs[arc].rightEdge;
+   m_arcs[right].rightEnd = m_arcs[arc].rightEnd;
+   m_arcs[arc].rightEdge = edge;
+   m_arcs[arc].rightEnd = 0;
+   m_arcs[middle].rightEdge = edge;
+   m_arcs[middle].rightEnd = 1;
+   insertAfter(arc, middle);
+   insertAfter(middle, right);
+
+   addCircleEvent(arc, sweepY);
+   addCircleEvent(right, sweepY);
+}
+
+
+template <typename T> void VoronoiFortune<T>::handleCircle(const CircleEvent& event)
+{
+   const Idx arc = event.arc;
+   const Idx prev = m_arcs[arc].prev;
+   const Idx next = m_arcs[arc].next;
+
+   // The edges on both sides of the arc end at the new vertex and a new edge
+   // between the neighbors starts there.
+   const Idx vertex = static_cast<Idx>(m_vertices.size());
+   m_vertices.emplace_back(static_cast<T>(event.centerX), static_cast<T>(event.centerY));
+   m_edges[m_arcs[prev].rightEdge].ends[m_arcs[prev].rightEnd] = vertex;
+   m_edges[m_arcs[arc].rightEdge].ends[m_arcs[arc].rightEnd] = vertex;
+
+   m_edges.push_back(Edge{m_arcs[prev].site, m_arcs[next].site, {vertex, NoIdx}});
+   m_arcs[prev].rightEdge = static_cast<Idx>(m_edges.size() - 1);
+   m_arcs[prev].rightEnd = 1;
+
+   m_arcs[prev].event = NoIdx;
+   m_arcs[next].event = NoIdx;
+   remove(arc);
+
+   addCircleEvent(prev, event.y);
+   addCircleEvent(next, event.y);
+}
+
+
+template <typename T> void VoronoiFortune<T>::addCircleEvent(Idx arc, Fp sweepY)
+{
+   const Idx prev = m_arcs[arc].prev;
+   const Idx next = m_arcs[arc].next;
+   if (prev == NoIdx || next == NoIdx || m_arcs[prev].site == m_arcs[next].site)
+      return;
+
+   // The breakpoints around the arc converge only if the sites turn clockwise.
+   const Point2<T>& a = m_sites[m_arcs[prev].site];
+   const Point2<T>& b = m_sites[m_arcs[arc].site];
+   const Point2<T>& c = m_sites[m_arcs[next].site];
+   if (orient2d(a, b, c) >= 0)
+      return;
+
+   const auto center = calcCircumcenter(a, b, c);
+   if (!center)
+      return;
+
+   CircleEvent event;
+   event.centerX = center->x();
+   event.centerY = center->y();
+   const Fp dx = event.centerX - Fp(b.x());
+   const Fp dy = event.centerY - Fp(b.y());
+   // The circle's bottom can't be above the sweep line. Rounding errors might
+   // put it there for events that happen right away.
+   event.y = std::min(event.centerY - std::sqrt(dx * dx + dy * dy), sweepY);
+   event.arc = arc;
+   event.id = m_nextEventId++;
+   m_arcs[arc].event = event.id;
+   m_events.push(event);
+}
+
+
+template <typename T>
+typename VoronoiFortune<T>::Idx VoronoiFortune<T>::findArcAbove(const Point2<T>& pt) const
+{
+   const Fp x = pt.x();
+   const Fp sweepY = pt.y();
+
+   Idx arc = m_root;
+   while (true)
+   {
+      const Arc& a = m_arcs[arc];
+      Idx child = NoIdx;
+      if (a.prev != NoIdx && x < calcBreakpoint(m_arcs[a.prev].site, a.site, sweepY))
+         child = a.left;
+      else if (a.next != NoIdx && x > calcBreakpoint(a.site, m_arcs[a.next].site, sweepY))
+         child = a.right;
+
+      if (child == NoIdx)
+         return arc;
+      arc = child;
+   }
+}
+
+
+template <typename T>
+typename VoronoiFortune<T>::Fp
+VoronoiFortune<T>::calcBreakpoint(Idx leftSite, Idx rightSite, Fp sweepY) const
+{
+   // Intersect the parabolas in coordinates relative to the left site and the
+   // sweep line. With dx the horizontal offset of the right site and h1, h2 the
+   // heights of the sites above the sweep line, the offset u of the breakpoint
+   // solves
+   //   (h2 - h1) u^2 + 2 h1 dx u - h1 (dx^2 + h2 (h2 - h1)) = 0.
+   // The root is chosen that belongs to the left site being on the left. It is
+   // calculated in the form that avoids cancellation.
+   const Point2<T>& ls = m_sites[leftSite];
+   const Point2<T>& rs = m_sites[rightSite];
+   const Fp x1 = ls.x();
+   const Fp dx = Fp(rs.x()) - x1;
+   const Fp h1 = Fp(ls.y()) - sweepY;
+   const Fp h2 = Fp(rs.y()) - sweepY;
+   // Arcs of sites on the sweep line are vertical rays.
+   if (h1 == h2)
+      return x1 + dx / Fp(2);
+   if (h1 == Fp(0))
+      return x1;
+   if (h2 == Fp(0))
+      return rs.x();
+
+   const Fp dh = h2 - h1;
+   const Fp dist = std::sqrt(dx * dx + dh * dh);
+   const Fp root = std::sqrt(h1 * h2) * dist;
+   if (h1 * dx >= Fp(0))
+      return x1 + h1 * (dx * dx + h2 * dh) / (root + h1 * dx);
+   return x1 + (root - h1 * dx) / dh;
+}
+
+
+template <typename T>
+typename VoronoiFortune<T>::Idx VoronoiFortune<T>::makeArc(Idx site)
+{
+   Idx arc = NoIdx;
+   if (!m_freeArcs.empty())
+   {
+      arc = m_freeArcs.back();
+      m_freeArcs.pop_back();
+   }
+   else
+   {
+      arc = static_cast<Idx>(m_arcs.size());
+      m_arcs.emplace_back();
+   }
+
+   // Xorshift generator for the treap priorities.
+   m_randState ^= m_randState << 13;
+   m_randState ^= m_randState >> 17;
+   m_randState ^= m_randState << 5;
+
+   m_arcs[arc] = Arc{};
+   m_arcs[arc].site = site;
+   m_arcs[arc].priority = m_randState;
+   return arc;
+}
+
+
+template <typename T> void VoronoiFortune<T>::insertAfter(Idx arc, Idx newArc)
+{
+   const Idx next = m_arcs[arc].next;
+   m_arcs[newArc].prev = arc;
+   m_arcs[newArc].next = next;
+   m_arcs[arc].next = newArc;
+   if (next != NoIdx)
+      m_arcs[next].prev = newArc;
+
+   // The new arc becomes the right child of the arc or, if that exists, the left
+   // child of the leftmost arc of the right subtree, which is the next arc.
+   if (m_arcs[arc].right == NoIdx)
+   {
+      m_arcs[arc].right = newArc;
+      m_arcs[newArc].parent = arc;
+   }
+   else
+   {
+      m_arcs[next].left = newArc;
+      m_arcs[newArc].parent = next;
+   }
+
+   while (m_arcs[newArc].parent != NoIdx &&
+          m_arcs[newArc].priority < m_arcs[m_arcs[newArc].parent].priority)
+      rotateUp(newArc);
+}
+
+
+template <typename T> void VoronoiFortune<T>::remove(Idx arc)
+{
+   // Rotate the arc down until it is a leaf.
+   while (m_arcs[arc].left != NoIdx || m_arcs[arc].right != NoIdx)
+   {
+      const Idx left = m_arcs[arc].left;
+      const Idx right = m_arcs[arc].right;
+      if (left == NoIdx)
+         rotateUp(right);
+      else if (right == NoIdx || m_arcs[left].priority < m_arcs[right].priority)
+         rotateUp(left);
+      else
+         rotateUp(right);
+   }
+
+   const Idx parent = m_arcs[arc].parent;
+   if (parent == NoIdx)
+      m_root = NoIdx;
+   else if (m_arcs[parent].left == arc)
+      m_arcs[parent].left = NoIdx;
+   else
+      m_arcs[parent].right = NoIdx;
+
+   const Idx prev = m_arcs[arc].prev;
+   const Idx next = m_arcs[arc].next;
+   if (prev != NoIdx)
+      m_arcs[prev].next = next;
+   if (next != NoIdx)
+      m_arcs[next].prev = prev;
+
+   m_arcs[arc].event = NoIdx;
+   m_freeArcs.push_back(arc);
+}
+
+
+template <typename T> void VoronoiFortune<T>::rotateUp(Idx arc)
+{
+   Arc& a = m_arcs[arc];
+   const Idx parent = a.parent;
+   Arc& p = m_arcs[parent];
+   const Idx grandparent = p.parent;
+
+   if (p.left == arc)
+   {
+      p.left = a.right;
+      if (a.right != NoIdx)
+         m_arcs[a.right].parent = parent;
+      a.right = parent;
+   }
+   else
+   {
+      p.right = a.left;
+      if (a.left != NoIdx)
+         m_arcs[a.left].parent = parent;
+      a.left = parent;
+   }
+   p.parent = arc;
+   a.parent = grandparent;
+
+   if (grandparent == NoIdx)
+      m_root = arc;
+   else if (m_arcs[grandparent].left == parent)
+      m_arcs[grandparent].left = arc;
+   else
+      m_arcs[grandparent].right = arc;
+}
+
+
+template <typename T> void VoronoiFortune<T>::collectSiteEdges()
+{
+   // Count the edges of each site and distribute them into consecutive ranges.
+   m_firstSiteEdge.assign(m_sites.size() + 1, 0);
+   for (const Edge& e : m_edges)
+   {
+      ++m_firstSiteEdge[e.left + 1];
+      ++m_firstSiteEdge[e.right + 1];
+   }
+   for (std::size_t i = 1; i < m_firstSiteEdge.size(); ++i)
+      m_firstSiteEdge[i] += m_firstSiteEdge[i - 1];
+
+   std::vector<Idx> pos{m_firstSiteEdge.begin(), m_firstSiteEdge.end() - 1};
+   m_siteEdges.resize(2 * m_edges.size());
+   for (Idx i = 0; i < m_edges.size(); ++i)
+   {
+      m_siteEdges[pos[m_edges[i].left]++] = i;
+      m_siteEdges[pos[m_edges[i].right]++] = i;
+   }
+
+   // The edges of a tile are in the same ccw order as the directions to the
+   // sites on the other side of them.
+   for (Idx site = 0; site < m_sites.size(); ++site)
+   {
+      const Point2<T>& center = m_sites[site];
+      const auto neighbor = [&](Idx edge) -> const Point2<T>& {
+         const Edge& e = m_edges[edge];
+         return m_sites[e.left == site ? e.right : e.left];
+      };
+      // Directions in the lower half plane come after the upper half plane.
+      const auto isLower = [&](const Point2<T>& pt) {
+         return pt.y() < center.y() || (pt.y() == center.y() && pt.x() < center.x());
+      };
+
+      std::sort(m_siteEdges.begin() + m_firstSiteEdge[site],
+                m_siteEdges.begin() + m_firstSiteEdge[site + 1], [&](Idx a, Idx b) {
+                   const Point2<T>& na = neighbor(a);
+                   const Point2<T>& nb = neighbor(b);
+                   const bool isLowerA = isLower(na);
+                   const bool isLowerB = isLower(nb);
+                   if (isLowerA != isLowerB)
+                      return isLowerB;
+                   return orient2d(center, na, nb) > 0;
+                });
+   }
+}
+
+
+template <typename T>
+Vec2<T> VoronoiFortune<T>::endDirection(const Edge& edge, std::size_t end) const
+{
+   // The breakpoint with the left site on its left moves perpendicular to the
+   // sites, keeping the right site on its right.
+   const Vec2<T> dir =
+      Vec2<T>{m_sites[edge.left], m_sites[edge.right]}.cwNormal(CoordSys::Cartesian);
+   return end == 1 ? dir : Vec2<T>{-dir.x(), -dir.y()};
+}
+
+} // namespace internals
+} // namespace geom
@@ -0,0 +1,293 @@
+//
+// geomcpp
+// Unclipped outlines of Voronoi tiles.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "point2.h"
+#include "poly2.h"
+#include "predicates.h"
+#include "rect.h"
+#include "vec2.h"
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+
+namespace geom
+{
+namespace internals
+{
+///////////////////
+
+// Creates a polygon from a given rectangle.
+template <typename T> Poly2<T> makePolygon(const Rect<T>& r)
+{
+   Poly2<T> poly;
+   poly.add(r.leftTop());
+   poly.add(r.leftBottom());
+   poly.add(r.rightBottom());
+   poly.add(r.rightTop());
+   return poly;
+}
+
+
+// Calculates the center of the circle through three given points. Returns
+// nothing for collinear points. Calculates relative to the middle point in at
+// least double precision, so centers of thin triangles stay accurate.
+template <typename T>
+std::optional<Point2<PredicateFp<T>>>
+calcCircumcenter(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c)
+{
+   using Fp = PredicateFp<T>;
+
+   const Fp ax = Fp(a.x()) - Fp(b.x());
+   const Fp ay = Fp(a.y()) - Fp(b.y());
+   const Fp cx = Fp(c.x()) - Fp(b.x());
+   const Fp cy = Fp(c.y()) - Fp(b.y());
+   const Fp d = Fp(2) * (ax * cy - ay * cx);
+   if (d == Fp(0))
+      return std::nullopt;
+
+   const Fp aa = ax * ax + ay * ay;
+   const Fp cc = cx * cx + cy * cy;
+   return Point2<Fp>{Fp(b.x()) + (cy * aa - ay * cc) / d,
+                     Fp(b.y()) + (ax * cc - cx * aa) / d};
+}
+
+
+///////////////////
+
+// Outline of a Voronoi tile before it is clipped by the border of the
+// tesselation. Tiles of sites on the hull of all sites are unbounded. Their
+// outline is open and extends to infinity along two rays.
+template <typename T> struct VoronoiOutline
+{
+   void clear();
+
+   // Corners of the tile in ccw order (cartesian coordinate system). For
+   // unbounded tiles the rays start at the first and at the last corner.
+   std::vector<Point2<T>> vertices;
+   bool isUnbounded = false;
+   // Direction of the ray that starts at the first corner. The outline comes in
+   // from infinity along it.
+   Vec2<T> startDir;
+   // Direction of the ray that starts at the last corner. The outline goes off
+   // to infinity along it.
+   Vec2<T> endDir;
+};
+
+
+template <typename T> void VoronoiOutline<T>::clear()
+{
+   vertices.clear();
+   isUnbounded = false;
+}
+
+
+///////////////////
+
+// Clips a polygon at one side of a rectangle. The side is given by the axis
+// that it is perpendicular to, its coordinate on that axis, and whether the
+// inside is below or above that coordinate. Appends the clipped polygon to a
+// given output list.
+template <typename T>
+void clipAtSide(const std::vector<Point2<T>>& poly, bool isVertical, T coord,
+                bool isInsideBelow, std::vector<Point2<T>>& clipped)
+{
+   auto value = [isVertical](const Point2<T>& pt) {
+      return isVertical ? pt.x() : pt.y();
+   };
+   auto isInside = [&](const Point2<T>& pt) {
+      return isInsideBelow ? value(pt) <= coord : value(pt) >= coord;
+   };
+   // Places the intersection exactly on the side, so that cells that share an
+   // edge get the same point.
+   auto intersect = [&](const Point2<T>& a, const Point2<T>& b) {
+      const T t = (coord - value(a)) / (value(b) - value(a));
+      return isVertical ? Point2<T>{coord, a.y() + t * (b.y() - a.y())}
+                        : Point2<T>{a.x() + t * (b.x() - a.x()), coord};
+   };
+   auto add = [&clipped](const Point2<T>& pt) {
+      if (clipped.empty() || clipped.back() != pt)
+         clipped.push_back(pt);
+   };
+
+   clipped.clear();
+   const Point2<T>* prev = &poly.back();
+   bool isPrevInside = isInside(*prev);
+   for (const Point2<T>& pt : poly)
+   {
+      const bool isPtInside = isInside(pt);
+      if (isPtInside != isPrevInside)
+         add(intersect(*prev, pt));
+      if (isPtInside)
+         add(pt);
+      prev = &pt;
+      isPrevInside = isPtInside;
+   }
+   if (clipped.size() > 1 && clipped.front() == clipped.back())
+      clipped.pop_back();
+}
+
+
+// Clips a given polygon at a given rectangle with the Sutherland-Hodgman
+// algorithm. The sides of the rectangle are axis-aligned, so the polygon is
+// only clipped at the sides that its bounding box crosses. Polygons that are
+// inside of the rectangle are not touched. Polygons that degenerate into a
+// point or a line are cleared.
+template <typename T>
+void clipPolygon(std::vector<Point2<T>>& poly, const Rect<T>& r,
+                 std::vector<Point2<T>>& buffer)
+{
+   if (poly.empty())
+      return;
+
+   T left = poly[0].x();
+   T right = left;
+   T top = poly[0].y();
+   T bottom = top;
+   for (const Point2<T>& pt : poly)
+   {
+      left = std::min(left, pt.x());
+      right = std::max(right, pt.x());
+      top = std::min(top, pt.y());
+      bottom = std::max(bottom, pt.y());
+   }
+
+   if (left > r.right() || right < r.left() || top > r.bottom() || bottom < r.top())
+   {
+      poly.clear();
+      return;
+   }
+
+   if (left < r.left())
+   {
+      clipAtSide(poly, true, r.left(), false, buffer);
+      poly.swap(buffer);
+   }
+   if (right > r.right())
+   {
+      clipAtSide(poly, true, r.right(), true, buffer);
+      poly.swap(buffer);
+   }
+   if (top < r.top())
+   {
+      clipAtSide(poly, false, r.top(), false, buffer);
+      poly.swap(buffer);
+   }
+   if (bottom > r.bottom())
+   {
+      clipAtSide(poly, false, r.bottom(), true, buffer);
+      poly.swap(buffer);
+   }
+
+   if (poly.size() < 3)
+      poly.clear();
+}
+
+
+// Clips a given convex polygon at a line through a given point in a given
+// direction. Keeps the part on the left of the line (cartesian coordinate
+// system). Appends the clipped polygon to a given output list.
+template <typename T>
+void clipAtLine(const std::vector<Point2<T>>& poly, const Point2<T>& start,
+                PredicateFp<T> dx, PredicateFp<T> dy, std::vector<Point2<T>>& clipped)
+{
+   using Fp = PredicateFp<T>;
+
+   auto side = [&](const Point2<T>& pt) {
+      return dx * (Fp(pt.y()) - Fp(start.y())) - dy * (Fp(pt.x()) - Fp(start.x()));
+   };
+   auto intersect = [](const Point2<T>& a, const Point2<T>& b, Fp sideA, Fp sideB) {
+      const Fp t = sideA / (sideA - sideB);
+      return Point2<T>{static_cast<T>(Fp(a.x()) + t * (Fp(b.x()) - Fp(a.x()))),
+                       static_cast<T>(Fp(a.y()) + t * (Fp(b.y()) - Fp(a.y())))};
+   };
+   auto add = [&clipped](const Point2<T>& pt) {
+      if (clipped.empty() || clipped.back() != pt)
+         clipped.push_back(pt);
+   };
+
+   clipped.clear();
+   const Point2<T>* prev = &poly.back();
+   Fp prevSide = side(*prev);
+   for (const Point2<T>& pt : poly)
+   {
+      const Fp ptSide = side(pt);
+      if ((ptSide >= Fp(0)) != (prevSide >= Fp(0)))
+         add(intersect(*prev, pt, prevSide, ptSide));
+      if (ptSide >= Fp(0))
+         add(pt);
+      prev = &pt;
+      prevSide = ptSide;
+   }
+   if (clipped.size() > 1 && clipped.front() == clipped.back())
+      clipped.pop_back();
+}
+
+
+// Clips an unbounded outline at a given rectangle. The outline is the
+// intersection of the half planes on the left of its edges and rays, so the
+// rectangle is cut down by each of their lines. This intersects the rays
+// directly with the rectangle and keeps the corners of the rectangle that are
+// inside of the outline.
+template <typename T>
+void clipUnboundedOutline(const VoronoiOutline<T>& outline, const Rect<T>& r,
+                          std::vector<Point2<T>>& poly, std::vector<Point2<T>>& buffer)
+{
+   using Fp = PredicateFp<T>;
+
+   // Corners in ccw order (cartesian coordinate system).
+   poly = {r.leftTop(), r.rightTop(), r.rightBottom(), r.leftBottom()};
+
+   // The outline runs against the direction of the start ray.
+   const std::vector<Point2<T>>& vertices = outline.vertices;
+   clipAtLine(poly, vertices.front(), -Fp(outline.startDir.x()),
+              -Fp(outline.startDir.y()), buffer);
+   poly.swap(buffer);
+
+   for (std::size_t i = 0; i + 1 < vertices.size() && !poly.empty(); ++i)
+   {
+      const Point2<T>& a = vertices[i];
+      const Point2<T>& b = vertices[i + 1];
+      clipAtLine(poly, a, Fp(b.x()) - Fp(a.x()), Fp(b.y()) - Fp(a.y()), buffer);
+      poly.swap(buffer);
+   }
+
+   if (!poly.empty())
+   {
+      clipAtLine(poly, vertices.back(), Fp(outline.endDir.x()), Fp(outline.endDir.y()),
+                 buffer);
+      poly.swap(buffer);
+   }
+
+   if (poly.size() < 3)
+      poly.clear();
+}
+
+
+// Clips the outline of a Voronoi tile at a given border. Returns the clipped
+// outline in cw order (cartesian coordinate system) like the general polygon
+// intersection does.
+template <typename T>
+Poly2<T> clipOutline(const VoronoiOutline<T>& outline, const Rect<T>& border)
+{
+   std::vector<Point2<T>> clipped;
+   std::vector<Point2<T>> buffer;
+   if (outline.isUnbounded)
+   {
+      clipUnboundedOutline(outline, border, clipped, buffer);
+   }
+   else
+   {
+      clipped = outline.vertices;
+      clipPolygon(clipped, border, buffer);
+   }
+   return Poly2<T>{clipped.rbegin(), clipped.rend()};
+}
+
+} // namespace internals
+} // namespace geom
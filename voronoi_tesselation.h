@@ -6,24 +6,27 @@
 // MIT license
 //
 #pragma once
-#include "delauney_triangle.h"
 #include "delauney_triangulation.h"
 #include "geom_util.h"
-#include "line_intersection2_ct.h"
+#include "indexed_triangulation.h"
 #include "line_inf2_ct.h"
-#include "line_ray2_ct.h"
 #include "line_seg2_ct.h"
-#include "poly_intersection2.h"
 #include "poly_line_cut2.h"
 #include "poly2.h"
 #include "rect.h"
+#include "triangle.h"
 #include "vec2.h"
+#include "voronoi_diagram.h"
+#include "voronoi_fortune.h"
+#include "voronoi_outline.h"
 #include "voronoi_tile.h"
 #include <algorithm>
-#include <optional>
-#include <unordered_map>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
 #include <utility>
-#include <variant>
 #include <vector>
 
 
@@ -33,431 +36,189 @@ namespace internals
 {
 ///////////////////
 
-// Creates a polygon from a given rectangle.
-// Overload for a collection of edges is further down.
-template <typename T> Poly2<T> makePolygon(const Rect<T>& r)
-{
-   Poly2<T> poly;
-   poly.add(r.leftTop());
-   poly.add(r.leftBottom());
-   poly.add(r.rightBottom());
-   poly.add(r.rightTop());
-   return poly;
-}
-
-
-///////////////////
-
-// An edge of the Voronoi tesselation can either be a line segment or a line ray.
-template <typename T> using VoronoiEdge = std::variant<ct::LineSeg2<T>, ct::LineRay2<T>>;
-
-template <typename T> Vec2<T> direction(const VoronoiEdge<T>& e)
-{
-   return std::visit([&](const auto& line) { return line.direction(); }, e);
-}
-
-template <typename T> bool hasEndPoint(const VoronoiEdge<T>& e)
-{
-   return std::visit([&](const auto& line) { return line.endPoint().has_value(); }, e);
-}
-
-// Voronoi edges (either a line segment or ray) always have a start point.
-template <typename T> Point2<T> startPoint(const VoronoiEdge<T>& e)
-{
-   return std::visit(
-      [&](const auto& line) {
-         assert(line.startPoint());
-         return *line.startPoint();
-      },
-      e);
-}
-
-template <typename T> std::optional<Point2<T>> endPoint(const VoronoiEdge<T>& e)
-{
-   return std::visit([&](const auto& line) { return line.endPoint(); }, e);
-}
-
-
-///////////////////
-
-// An edge of the Delauney triangulation and the one or two triangles that
-// it is part of.
-template <typename T> class DelauneyEdge
+// Builds the outlines of Voronoi tiles from the adjacency of the triangles of a
+// Delauney triangulation. The tile of a vertex is formed by the circumcenters
+// of the triangles around it. Walking the triangles around a vertex in ccw
+// order produces the circumcenters in ccw order, so no sorting or searching of
+// edges is needed.
+// For vertices on the hull of the triangulation the outline is open. Its rays
+// leave the hull perpendicular to the hull edges.
+template <typename T> class VoronoiTileBuilder
 {
  public:
-   DelauneyEdge(ct::LineSeg2<T> edge, DelauneyTriangle<T> t);
-   ~DelauneyEdge() = default;
-   DelauneyEdge(const DelauneyEdge&) = default;
-   DelauneyEdge(DelauneyEdge&&) = default;
-
-   DelauneyEdge& operator=(const DelauneyEdge&) = default;
-   DelauneyEdge& operator=(DelauneyEdge&&) = default;
-
-   // Add a given triangle to the triangles that the edge is part of.
-   void addTriangle(const DelauneyTriangle<T>& t) { m_triangles.second = t; }
-   // Checks if this edge is the same as a given edge. The check is direction
-   // insensitive.
-   bool isEdge(const ct::LineSeg2<T>& e) const;
-   // Creates a Voronoi edge for this edge.
-   std::optional<VoronoiEdge<T>> makeVoronoiEdge() const;
-
- private:
-   // Creates a Voronoi edge between two given Delauney triangles.
-   static std::optional<VoronoiEdge<T>>
-   makeVoronoiEdgeBetweenTriangles(const DelauneyTriangle<T>& a,
-                                   const DelauneyTriangle<T>& b);
-   // Creates a Voronoi edge for a given Delauney edge that only has one
-   // adjacent Delauney triangle.
-   static std::optional<VoronoiEdge<T>>
-   makeInfiniteVoronoiEdge(const ct::LineSeg2<T>& delauneyEdge,
-                           const DelauneyTriangle<T>& triangle);
-
- private:
-   ct::LineSeg2<T> m_edge;
-   std::pair<DelauneyTriangle<T>, std::optional<DelauneyTriangle<T>>> m_triangles;
-};
-
-
-template <typename T>
-DelauneyEdge<T>::DelauneyEdge(ct::LineSeg2<T> edge, DelauneyTriangle<T> t)
-: m_edge{std::move(edge)}, m_triangles{std::move(t), std::nullopt}
-{
-}
-
-template <typename T> bool DelauneyEdge<T>::isEdge(const ct::LineSeg2<T>& e) const
-{
-   // It's ok to dereference start and end points because line segments are guaranteed
-   // to have them.
-   assert(m_edge.startPoint().has_value() && m_edge.endPoint().has_value());
-   assert(e.startPoint().has_value() && e.endPoint().has_value());
-   const Point2<T>& sa = *m_edge.startPoint();
-   const Point2<T>& ea = *m_edge.endPoint();
-   const Point2<T>& sb = *e.startPoint();
-   const Point2<T>& eb = *e.endPoint();
-   return (sa == sb && ea == eb) || (sa == eb && ea == sb);
-}
-
-
-template <typename T>
-std::optional<VoronoiEdge<T>> DelauneyEdge<T>::makeVoronoiEdge() const
-{
-   if (!m_triangles.second)
-      return makeInfiniteVoronoiEdge(m_edge, m_triangles.first);
-   return makeVoronoiEdgeBetweenTriangles(m_triangles.first, *m_triangles.second);
-}
-
-
-template <typename T>
-std::optional<VoronoiEdge<T>>
-DelauneyEdge<T>::makeVoronoiEdgeBetweenTriangles(const DelauneyTriangle<T>& a,
-                                                 const DelauneyTriangle<T>& b)
-{
-   const Point2<T> ca = a.circumcenter();
-   const Point2<T> cb = b.circumcenter();
-   if (ca != cb)
-      return std::make_optional<VoronoiEdge<T>>(ct::LineSeg2<T>(ca, cb));
-   // Degenerate edge.
-   return std::nullopt;
-}
+   static constexpr std::uint32_t NoIdx = IndexedTriangulation<T>::NoNeighbor;
 
+   // The triangulation has to include the neighbors of its triangles.
+   explicit VoronoiTileBuilder(const IndexedTriangulation<T>& triangulation);
 
-template <typename T>
-std::optional<VoronoiEdge<T>>
-DelauneyEdge<T>::makeInfiniteVoronoiEdge(const ct::LineSeg2<T>& delauneyEdge,
-                                         const DelauneyTriangle<T>& triangle)
-{
-   // The cirumcenter of the triangle is the start point of the Voronoi
-   // edge and the edge travels in the direction away from the triangle.
-   // Since the triangle is oriented ccw, a cw normal to any of its edges
-   // points away from it.
-   const VoronoiEdge<T> ve =
-      ct::LineRay2<T>{triangle.circumcenter(), delauneyEdge.direction().cwNormal()};
-   // Optional will always be filled here. The return type is only optional to match
-   // the signature of the other 'make Voronoi edge' functions.
-   return std::make_optional(ve);
-}
-
-
-///////////////////
-
-// Collection of Delauney edges involved in constructing of a Voronoi tile.
-template <typename T> class DelauneyEdgeCollection
-{
- public:
-   // Adds an edge to the collection.
-   void addEdge(const ct::LineSeg2<T>& edge, const DelauneyTriangle<T>& t);
-   // Generates Voronoi edges for the collection of Delauney edges.
-   std::vector<VoronoiEdge<T>> makeVoronoiEdges() const;
-
- private:
-   // Returns the index of a given edge it it is in the collection or null.
-   typename std::vector<DelauneyEdge<T>>::iterator findEdge(const ct::LineSeg2<T>& edge);
-
- private:
-   std::vector<DelauneyEdge<T>> m_edges;
-};
-
-
-template <typename T>
-void DelauneyEdgeCollection<T>::addEdge(const ct::LineSeg2<T>& edge,
-                                        const DelauneyTriangle<T>& t)
-{
-   auto pos = findEdge(edge);
-   if (pos != m_edges.end())
-      pos->addTriangle(t);
-   else
-      m_edges.push_back(DelauneyEdge<T>{edge, t});
-}
-
-
-template <typename T>
-std::vector<VoronoiEdge<T>> DelauneyEdgeCollection<T>::makeVoronoiEdges() const
-{
-   std::vector<VoronoiEdge<T>> voronoiEdges;
-   for (const auto& de : m_edges)
+   std::size_t numSites() const { return m_firstCorner.size(); }
+   const Point2<T>& site(std::uint32_t vertex) const
    {
-      auto ve = de.makeVoronoiEdge();
-      if (ve)
-         voronoiEdges.push_back(*ve);
+      return m_triangulation.vertices[vertex];
    }
-   return voronoiEdges;
-}
-
-
-template <typename T>
-typename std::vector<DelauneyEdge<T>>::iterator
-DelauneyEdgeCollection<T>::findEdge(const ct::LineSeg2<T>& edge)
-{
-   return std::find_if(m_edges.begin(), m_edges.end(),
-                       [&](const DelauneyEdge<T>& de) { return de.isEdge(edge); });
-}
-
-
-///////////////////
-
-// Builds a polygon from an unordered list of edges. Clips polygon at given bounds.
-template <typename T> class PolygonBuilder
-{
- public:
-   PolygonBuilder(std::vector<VoronoiEdge<T>> edges, const Rect<T>& clipBounds);
-   ~PolygonBuilder() = default;
-   PolygonBuilder(const PolygonBuilder&) = default;
-   PolygonBuilder(PolygonBuilder&&) = default;
-
-   PolygonBuilder& operator=(const PolygonBuilder&) = default;
-   PolygonBuilder& operator=(PolygonBuilder&&) = default;
-
-   // Builds the polygon.
-   Poly2<T> build();
+   // Builds the outline of the tile of the vertex at a given index. Reuses the
+   // memory of the given outline.
+   void build(std::uint32_t vertex, VoronoiOutline<T>& outline) const;
+   // Builds the diagram of all vertices clipped by a given border.
+   VoronoiDiagram<T> makeDiagram(const Rect<T>& border) const;
 
  private:
-   // Returns an order list of vertices that results from connecting the
-   // available edges.
-   std::vector<Point2<T>> createVertexSequence();
-   // Returns those edges from a given list that do not connect to an other
-   // edge at one of their endpoints.
-   std::vector<VoronoiEdge<T>> findEndEdges();
-   // Orders the available edges. Uses given edges at start and end.
-   std::vector<Point2<T>> orderEdges(const std::vector<VoronoiEdge<T>>& endEdges);
-   // Returns a point far past the end point of a given line.
-   static Point2<T> calcDistantPoint(const VoronoiEdge<T>& edge);
-   // Finds the edge that connects to a given previous edge.
-   std::optional<VoronoiEdge<T>> findNextEdge(const std::optional<Point2<T>>& connector);
-   // Checks if a given point exists as endpoint of an edge excluding
-   // a specific edge at a given index. Use -1 to include all edges.
-   int findEndpoint(const std::optional<Point2<T>>& pt, int excludedIdx) const;
-   // Make sures end edges do not intersect before they end at their distant
-   // end points. The polygon would not be convex in that case, creating
-   // problems when intersecting it with the border.
-   static void fixIntersectingEndEdges(std::vector<Point2<T>>& vertices);
+   // Returns the position of a given vertex within a given triangle.
+   std::size_t cornerOf(std::uint32_t triangle, std::uint32_t vertex) const;
+   // Appends a point to an outline unless it is equal to the previous point.
+   static void addPoint(const Point2<T>& pt, std::vector<Point2<T>>& vertices);
 
  private:
-   std::vector<VoronoiEdge<T>> m_edges;
-   Poly2<T> m_clip;
+   const IndexedTriangulation<T>& m_triangulation;
+   std::vector<Point2<T>> m_circumcenters;
+   // For each vertex the index of a triangle corner (3 * triangle + position)
+   // where the ccw walk around the vertex starts. For vertices on the hull it is
+   // the triangle whose cw edge at the vertex is on the hull.
+   std::vector<std::uint32_t> m_firstCorner;
 };
 
 
 template <typename T>
-PolygonBuilder<T>::PolygonBuilder(std::vector<VoronoiEdge<T>> edges,
-                                  const Rect<T>& clipBounds)
-: m_edges{std::move(edges)}, m_clip{makePolygon(clipBounds)}
+VoronoiTileBuilder<T>::VoronoiTileBuilder(const IndexedTriangulation<T>& triangulation)
+: m_triangulation{triangulation}
 {
-}
+   assert(triangulation.hasNeighbors());
 
-
-template <typename T> Poly2<T> PolygonBuilder<T>::build()
-{
-   const std::vector<Point2<T>> vertexSeq{createVertexSequence()};
-   const Poly2<T> unclipped{vertexSeq.cbegin(), vertexSeq.cend()};
-   return intersectConvexPolygons(unclipped, m_clip);
-}
-
-template <typename T> std::vector<Point2<T>> PolygonBuilder<T>::createVertexSequence()
-{
-   if (m_edges.empty())
-      return {};
-
-   std::vector<VoronoiEdge<T>> endEdges = findEndEdges();
-   std::vector<Point2<T>> vertices = orderEdges(endEdges);
-
-   return vertices;
-}
-
-
-template <typename T> std::vector<VoronoiEdge<T>> PolygonBuilder<T>::findEndEdges()
-{
-   std::vector<VoronoiEdge<T>> result;
-
-   // Keep track of found edges so that we can delete them later.
-   std::vector<int> foundEdges;
-
-   for (int i = 0; i < m_edges.size(); ++i)
+   const std::size_t numTriangles = triangulation.numTriangles();
+   m_circumcenters.reserve(numTriangles);
+   for (std::size_t i = 0; i < numTriangles; ++i)
    {
-      const VoronoiEdge<T>& e = m_edges[i];
-      if (!hasEndPoint(e))
-      {
-         result.push_back(e);
-         foundEdges.push_back(i);
-      }
-
-      // We can stop after we found two.
-      if (foundEdges.size() > 1)
-         break;
+      // Triangles of the mesh are never degenerate but can be very thin.
+      const Triangle<T> t = triangulation.triangle(i);
+      const auto center = calcCircumcenter(t[0], t[1], t[2]);
+      assert(center);
+      m_circumcenters.push_back(center ? Point2<T>{static_cast<T>(center->x()),
+                                                   static_cast<T>(center->y())}
+                                       : t[0]);
    }
 
-   // Remove the found end edges from the available edges.
-   for (int i = static_cast<int>(foundEdges.size()) - 1; i >= 0; --i)
-      m_edges.erase(m_edges.begin() + foundEdges[i]);
-
-   return result;
+   const auto& indices = triangulation.indices;
+   const auto& neighbors = triangulation.neighbors;
+   m_firstCorner.assign(triangulation.vertices.size(), NoIdx);
+   for (std::uint32_t corner = 0; corner < indices.size(); ++corner)
+   {
+      std::uint32_t& first = m_firstCorner[indices[corner]];
+      // The cw edge at the vertex leads to its next vertex. The neighbor across
+      // it is opposite of the third vertex.
+      const std::uint32_t third = corner - corner % 3 + (corner + 2) % 3;
+      if (first == NoIdx || neighbors[third] == NoIdx)
+         first = corner;
+   }
 }
 
 
 template <typename T>
-std::vector<Point2<T>>
-PolygonBuilder<T>::orderEdges(const std::vector<VoronoiEdge<T>>& endEdges)
-{
-   // There should be either zero or two end edges.
-   const bool isOpenPath = endEdges.size() == 2;
-
-   std::vector<Point2<T>> vertices;
-
-   std::optional<VoronoiEdge<T>> nextEdge;
-   if (isOpenPath)
-   {
-      // Process the given start edge first.
-      VoronoiEdge<T> startEdge = endEdges[0];
-      vertices.push_back(calcDistantPoint(startEdge));
-      nextEdge = findNextEdge(startPoint(startEdge));
-   }
-   else
+void VoronoiTileBuilder<T>::build(std::uint32_t vertex,
+                                  VoronoiOutline<T>& outline) const
+{
+   outline.clear();
+   const std::uint32_t firstCorner = m_firstCorner[vertex];
+   if (firstCorner == NoIdx)
+      return;
+
+   const auto& indices = m_triangulation.indices;
+   const auto& neighbors = m_triangulation.neighbors;
+   const auto& vertices = m_triangulation.vertices;
+   const Point2<T>& pt = vertices[vertex];
+
+   std::uint32_t triangle = firstCorner / 3;
+   std::size_t pos = firstCorner % 3;
+
+   // The tile of a vertex on the hull starts with a ray that crosses the hull
+   // edge to the next vertex of the first triangle.
+   outline.isUnbounded = neighbors[3 * triangle + (pos + 2) % 3] == NoIdx;
+   if (outline.isUnbounded)
    {
-      // We can start with any edges. Use the first one.
-      nextEdge = m_edges[0];
-      m_edges.erase(m_edges.begin());
+      const Point2<T>& next = vertices[indices[3 * triangle + (pos + 1) % 3]];
+      outline.startDir = Vec2<T>{pt, next}.cwNormal(CoordSys::Cartesian);
    }
 
-   // Concatenate the edges and store each start point.
-   while (nextEdge)
+   while (true)
    {
-      vertices.push_back(startPoint(*nextEdge));
-      nextEdge = findNextEdge(endPoint(*nextEdge));
-   }
+      addPoint(m_circumcenters[triangle], outline.vertices);
 
-   // Append the end points of the given end edge.
-   if (isOpenPath)
-   {
-      vertices.push_back(startPoint(endEdges[1]));
-      vertices.push_back(calcDistantPoint(endEdges[1]));
+      // The next triangle in ccw order is across the edge to the previous
+      // vertex.
+      const std::uint32_t neighbor = neighbors[3 * triangle + (pos + 1) % 3];
+      if (neighbor == NoIdx)
+      {
+         // Reached the hull again. Leave it through the edge from the previous
+         // vertex.
+         const Point2<T>& prev = vertices[indices[3 * triangle + (pos + 2) % 3]];
+         outline.endDir = Vec2<T>{prev, pt}.cwNormal(CoordSys::Cartesian);
+         break;
+      }
+      if (neighbor == firstCorner / 3)
+         break;
 
-      fixIntersectingEndEdges(vertices);
+      triangle = neighbor;
+      pos = cornerOf(triangle, vertex);
    }
 
-   return vertices;
-}
-
-
-template <typename T>
-Point2<T> PolygonBuilder<T>::calcDistantPoint(const VoronoiEdge<T>& edge)
-{
-   static constexpr T FarDist = 100000;
-   const Vec2<T> normedDir = direction(edge).normalize();
-   const Vec2<T> far = normedDir.scale(FarDist);
-   return startPoint(edge).offset(far.x(), far.y());
+   std::vector<Point2<T>>& corners = outline.vertices;
+   if (!outline.isUnbounded && corners.size() > 1 && corners.front() == corners.back())
+      corners.pop_back();
 }
 
 
 template <typename T>
-std::optional<VoronoiEdge<T>>
-PolygonBuilder<T>::findNextEdge(const std::optional<Point2<T>>& connector)
-{
-   if (!connector)
-      return std::nullopt;
-
-   const int edgeIdx = findEndpoint(connector, -1);
-   if (edgeIdx == -1)
-      return std::nullopt;
-
-   const VoronoiEdge<T> e = m_edges[edgeIdx];
-   m_edges.erase(m_edges.begin() + edgeIdx);
+VoronoiDiagram<T> VoronoiTileBuilder<T>::makeDiagram(const Rect<T>& border) const
+{
+   // Each triangle edge separates the tiles of its vertices. The edge of the
+   // diagram leads from the triangle's circumcenter to the circumcenter of the
+   // neighbor across it. Edges on the hull lead to infinity.
+   const auto& indices = m_triangulation.indices;
+   const auto& neighbors = m_triangulation.neighbors;
+   std::vector<VoronoiEdge> edges;
+   edges.reserve(indices.size() / 2 + 1);
+   for (std::uint32_t corner = 0; corner < indices.size(); ++corner)
+   {
+      const std::uint32_t triangle = corner / 3;
+      const std::uint32_t neighbor = neighbors[corner];
+      if (neighbor != NoIdx && neighbor < triangle)
+         continue;
+
+      // The triangle is on the left of the edge opposite of the corner. The
+      // edge of the diagram points away from the triangle.
+      const std::uint32_t base = corner - corner % 3;
+      edges.push_back(VoronoiEdge{indices[base + (corner + 1) % 3],
+                                  indices[base + (corner + 2) % 3],
+                                  {triangle, neighbor}});
+   }
 
-   // Make sure the end points of the edge are in the correct order.
-   if (*connector == startPoint(e))
-      return e;
-   // Flip the found edge.
-   return ct::LineSeg2<T>(*endPoint(e), startPoint(e));
+   return VoronoiDiagramBuilder<T>::build(m_triangulation.vertices, m_circumcenters,
+                                          edges, border);
 }
 
 
 template <typename T>
-int PolygonBuilder<T>::findEndpoint(const std::optional<Point2<T>>& pt,
-                                    int excludedIdx) const
+std::size_t VoronoiTileBuilder<T>::cornerOf(std::uint32_t triangle,
+                                            std::uint32_t vertex) const
 {
-   for (int i = 0; i < m_edges.size(); ++i)
-   {
-      if (i != excludedIdx &&
-          (startPoint(m_edges[i]) == pt || endPoint(m_edges[i]) == pt))
-      {
-         return i;
-      }
-   }
-   return -1;
+   const auto& indices = m_triangulation.indices;
+   if (indices[3 * triangle] == vertex)
+      return 0;
+   return indices[3 * triangle + 1] == vertex ? 1 : 2;
 }
 
 
 template <typename T>
-void PolygonBuilder<T>::fixIntersectingEndEdges(std::vector<Point2<T>>& vertices)
+void VoronoiTileBuilder<T>::addPoint(const Point2<T>& pt,
+                                     std::vector<Point2<T>>& vertices)
 {
-   const auto x = intersect(
-      ct::LineSeg2{vertices[1], vertices[0]},
-      ct::LineSeg2{vertices[vertices.size() - 2], vertices[vertices.size() - 1]});
-   if (x && std::holds_alternative<Point2<T>>(*x))
-   {
-      const Point2<T> xPt = std::get<Point2<T>>(*x);
-
-      // It's ok if the intersection is at the start points.
-      if (xPt != vertices[1] && xPt != vertices[vertices.size() - 2])
-      {
-         vertices[0] = xPt;
-         vertices[vertices.size() - 1] = xPt;
-      }
-   }
+   // Triangles with the same circumcircle share their circumcenter.
+   if (vertices.empty() || vertices.back() != pt)
+      vertices.push_back(pt);
 }
 
 
 ///////////////////
 
-// Creates a polygon from given unordered edges.
-// Overload for a simple rectangle is further up.
-template <typename T>
-Poly2<T> makePolygon(const std::vector<VoronoiEdge<T>>& edges,
-                     const Rect<T>& borderBounds)
-{
-   PolygonBuilder<T> builder{edges, borderBounds};
-   return builder.build();
-}
-
-
 // Checks if a given point and polygon are on the same side of a given line.
 template <typename T>
 bool areOnSameSideOf(const Point2<T>& pt, const Poly2<T>& poly,
@@ -480,14 +241,39 @@ bool areOnSameSideOf(const Point2<T>& pt, const Poly2<T>& poly,
 } // namespace internals
 
 
+///////////////////
+
+// Algorithms that the Voronoi tesselation can be calculated with.
+enum class VoronoiAlgorithm
+{
+   // Builds the tiles from a Delauney triangulation of the samples.
+   DelauneyDual,
+   // Fortune's sweep line algorithm. Builds the tiles directly.
+   Fortune
+};
+
+
 ///////////////////
 
 template <typename T> class VoronoiTesselation
 {
  public:
-   explicit VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples);
-   VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples, T borderOffset);
-   VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples, const Rect<T>& border);
+   // The samples have to be free of duplicates. PointWelder removes them and
+   // maps the original samples to the remaining ones, i.e. to their tiles.
+   // The tiles can be built on multiple threads. With multiple threads the
+   // Delauney dual triangulates the samples with the parallel
+   // divide-and-conquer algorithm. The tiles don't depend on the number of
+   // threads but their order can.
+   explicit VoronoiTesselation(
+      const std::vector<Point2<T>>& uniqueSamples,
+      VoronoiAlgorithm algorithm = VoronoiAlgorithm::DelauneyDual,
+      std::size_t numThreads = 1);
+   VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples, T borderOffset,
+                      VoronoiAlgorithm algorithm = VoronoiAlgorithm::DelauneyDual,
+                      std::size_t numThreads = 1);
+   VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples, const Rect<T>& border,
+                      VoronoiAlgorithm algorithm = VoronoiAlgorithm::DelauneyDual,
+                      std::size_t numThreads = 1);
    ~VoronoiTesselation() = default;
    VoronoiTesselation(const VoronoiTesselation&) = default;
    VoronoiTesselation(VoronoiTesselation&&) = default;
@@ -497,11 +283,18 @@ template <typename T> class VoronoiTesselation
 
    // Starts the Voronoi tesselation.
    std::vector<VoronoiTile<T>> tesselate();
+   // Starts the Voronoi tesselation and returns the result as a diagram that
+   // stores each vertex once and knows the neighboring cells of each cell. The
+   // diagram has a cell for each sample, even for samples whose cell is outside
+   // of the border. The result is not accessible through tesselate().
+   VoronoiDiagram<T> tesselateIndexed();
    // Returns the Delauney triangulation that was used to perform the tesselation.
+   // Empty for algorithms that don't triangulate the samples.
    const std::vector<Triangle<T>>& getTriangulation() const { return m_triangulation; }
 
  private:
-   using EdgeMap = std::unordered_map<Point2<T>, internals::DelauneyEdgeCollection<T>>;
+   // Minimal number of tiles that are worth building on a separate thread.
+   static constexpr std::size_t MinParallelTiles = 5000;
 
    // Degenerate tesselation into a single tile.
    std::vector<VoronoiTile<T>> tesselateIntoSingleTile();
@@ -511,11 +304,14 @@ template <typename T> class VoronoiTesselation
    // Calculates bounding box at a given offset around a given list of points.
    static Rect<T> calcBorder(const std::vector<Point2<T>>& points, T offset);
    // Performs a Delauney triangulation for the configured sample points.
-   std::vector<DelauneyTriangle<T>> delauneyTriangulation();
-   // Collects all edges of Delauney triangles that share a given sample
-   // point.
-   EdgeMap
-   collectDelauneyEdges(const std::vector<DelauneyTriangle<T>>& delauneyTriangles) const;
+   IndexedTriangulation<T> delauneyTriangulation();
+   // Clips the outlines that a given builder creates for its sites into tiles.
+   template <typename Builder> void makeTiles(const Builder& builder);
+   // Makes the tiles for the sites in the range [first, last) and appends them
+   // to a given buffer.
+   template <typename Builder>
+   static void makeTiles(const Builder& builder, const Rect<T>& border, std::size_t first,
+                         std::size_t last, std::vector<VoronoiTile<T>>& tiles);
 
  private:
    // List of points to generate the Voronoi tesselation for.
@@ -523,6 +319,8 @@ template <typename T> class VoronoiTesselation
    // Border around the sample points. Used to terminate Voronoi edges that
    // would extend to infinity.
    Rect<T> m_border;
+   VoronoiAlgorithm m_algorithm = VoronoiAlgorithm::DelauneyDual;
+   std::size_t m_numThreads = 1;
    // List of tiles generated by the the tesselation.
    std::vector<VoronoiTile<T>> m_tiles;
    // Triangles of the Delauney triangulation. A by-product of the tesselation
@@ -532,24 +330,31 @@ template <typename T> class VoronoiTesselation
 
 
 template <typename T>
-VoronoiTesselation<T>::VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples)
-: VoronoiTesselation{uniqueSamples, T(0)}
+VoronoiTesselation<T>::VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples,
+                                          VoronoiAlgorithm algorithm,
+                                          std::size_t numThreads)
+: VoronoiTesselation{uniqueSamples, T(0), algorithm, numThreads}
 {
 }
 
 
 template <typename T>
 VoronoiTesselation<T>::VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples,
-                                          T borderOffset)
-: VoronoiTesselation{uniqueSamples, calcBorder(uniqueSamples, borderOffset)}
+                                          T borderOffset, VoronoiAlgorithm algorithm,
+                                          std::size_t numThreads)
+: VoronoiTesselation{uniqueSamples, calcBorder(uniqueSamples, borderOffset), algorithm,
+                     numThreads}
 {
 }
 
 
 template <typename T>
 VoronoiTesselation<T>::VoronoiTesselation(const std::vector<Point2<T>>& uniqueSamples,
-                                          const Rect<T>& border)
-: m_samples{uniqueSamples}, m_border{border}
+                                          const Rect<T>& border,
+                                          VoronoiAlgorithm algorithm,
+                                          std::size_t numThreads)
+: m_samples{uniqueSamples}, m_border{border}, m_algorithm{algorithm},
+  m_numThreads{numThreads}
 {
 }
 
@@ -564,40 +369,45 @@ template <typename T> std::vector<VoronoiTile<T>> VoronoiTesselation<T>::tessela
    if (m_samples.size() == 2)
       return tesselateIntoTwoTiles();
 
-   // General case for more than three sample points.
+   if (m_algorithm == VoronoiAlgorithm::Fortune)
+   {
+      // The sweep builds the tiles without triangulating the samples. Its tiles
+      // are ordered like the sites in the sweep.
+      makeTiles(internals::VoronoiFortune<T>{m_samples});
+      return m_tiles;
+   }
+
+   // General case for three or more sample points.
    // - Each sample point is the seed of a Voronoi tile.
    // - Perform Delauney triangulation.
-   // - For each sample point collect all Delauney edges that share it.
-   // - From each Delauney edge build the corresponding Voronoi edge as
-   //   follows:
-   // -   If two Delauney triangles share the edge, then the Voronoi edge
-   //     is the line connecting the triangles' circumcenters.
-   // -   If only one Delauney triangle contains the edge, then the Voronoi
-   //     edge is clipped by the given border.
-   // - Combine the collected Voronoi edges into a polygon that forms the
-   //   outline of the Voronoi tile for the processed sample point.
-
-   // Run triangulation.
-   std::vector<DelauneyTriangle<T>> delauneyTriangles = delauneyTriangulation();
-
-   // Associates each vertex of all Delauney triangles with the edges
-   // that connect to it.
-   EdgeMap edgeMap = collectDelauneyEdges(delauneyTriangles);
-
-   // Calculate the Voronoi tile for each sample point. (The Delauney
-   // vertices might actually be slightly off the original sample points
-   // because of floating point calculation inaccuracies).
-   for (auto& [sample, delauneyEdges] : edgeMap)
-   {
-      const std::vector<internals::VoronoiEdge<T>> voronoiEdges =
-         delauneyEdges.makeVoronoiEdges();
+   // - The outline of the tile of a sample point connects the circumcenters of
+   //   the Delauney triangles around the point. Walking from triangle to
+   //   triangle through their neighbors visits them in order.
+   // - Tiles of points on the hull of the triangulation extend to infinity.
+   //   Their outlines are clipped by the given border.
+   // The tiles are ordered like the vertices of the triangulation.
+
+   const IndexedTriangulation<T> triangulation = delauneyTriangulation();
+   // Collinear samples can't be triangulated.
+   if (triangulation.numTriangles() == 0)
+      return m_tiles;
+   makeTiles(internals::VoronoiTileBuilder<T>{triangulation});
+   return m_tiles;
+}
 
-      const Poly2<T> voronoiPoly = internals::makePolygon(voronoiEdges, m_border);
-      if (voronoiPoly.size() > 0)
-         m_tiles.emplace_back(sample, voronoiPoly);
+
+template <typename T> VoronoiDiagram<T> VoronoiTesselation<T>::tesselateIndexed()
+{
+   if (m_algorithm == VoronoiAlgorithm::DelauneyDual)
+   {
+      const IndexedTriangulation<T> triangulation = delauneyTriangulation();
+      if (triangulation.numTriangles() > 0)
+         return internals::VoronoiTileBuilder<T>{triangulation}.makeDiagram(m_border);
    }
 
-   return m_tiles;
+   // Less than three samples or collinear samples can't be triangulated. The
+   // sweep handles them.
+   return internals::VoronoiFortune<T>{m_samples}.makeDiagram(m_border);
 }
 
 
@@ -670,42 +480,74 @@ Rect<T> VoronoiTesselation<T>::calcBorder(const std::vector<Point2<T>>& points,
 
 
 template <typename T>
-std::vector<DelauneyTriangle<T>> VoronoiTesselation<T>::delauneyTriangulation()
-{
-   DelauneyTriangulation delauney{m_samples};
-   m_triangulation = delauney.triangulate();
-   return delauney.delauneyTriangles();
+template <typename Builder>
+void VoronoiTesselation<T>::makeTiles(const Builder& builder)
+{
+   const std::size_t numSites = builder.numSites();
+   const std::size_t numThreads = std::clamp<std::size_t>(
+      numSites / MinParallelTiles, 1, std::max<std::size_t>(m_numThreads, 1));
+
+   // Each thread builds the tiles of a consecutive range of sites into its own
+   // buffer. The builder is only read. Appending the buffers in order keeps the
+   // tiles in the order of the sites.
+   std::vector<std::vector<VoronoiTile<T>>> buffers(numThreads);
+   std::vector<std::future<void>> threads;
+   for (std::size_t i = 1; i < numThreads; ++i)
+   {
+      threads.push_back(std::async(std::launch::async, [&, i]() {
+         makeTiles(builder, m_border, i * numSites / numThreads,
+                   (i + 1) * numSites / numThreads, buffers[i]);
+      }));
+   }
+   makeTiles(builder, m_border, 0, numSites / numThreads, buffers[0]);
+   for (auto& thread : threads)
+      thread.get();
+
+   m_tiles.reserve(m_tiles.size() + numSites);
+   for (auto& buffer : buffers)
+      m_tiles.insert(m_tiles.end(), std::make_move_iterator(buffer.begin()),
+                     std::make_move_iterator(buffer.end()));
 }
 
 
 template <typename T>
-typename VoronoiTesselation<T>::EdgeMap VoronoiTesselation<T>::collectDelauneyEdges(
-   const std::vector<DelauneyTriangle<T>>& delauneyTriangles) const
-{
-   EdgeMap edgeMap;
-
-   for (const auto& dt : delauneyTriangles)
+template <typename Builder>
+void VoronoiTesselation<T>::makeTiles(const Builder& builder, const Rect<T>& border,
+                                      std::size_t first, std::size_t last,
+                                      std::vector<VoronoiTile<T>>& tiles)
+{
+   tiles.reserve(last - first);
+   internals::VoronoiOutline<T> outline;
+   for (std::size_t i = first; i < last; ++i)
    {
-      for (std::size_t i = 0; i < 3; ++i)
-      {
-         const Point2<T> v = dt[i];
-         auto pos = edgeMap.find(v);
-         if (pos == edgeMap.end())
-         {
-            bool inserted = false;
-            std::tie(pos, inserted) = edgeMap.insert(
-               EdgeMap::value_type(v, internals::DelauneyEdgeCollection<T>{}));
-            assert(inserted);
-         }
-
-         // Keep edges ordered.
-         internals::DelauneyEdgeCollection<T>& edges = pos->second;
-         edges.addEdge(ct::LineSeg2<T>{dt[i == 0 ? 2 : i - 1], v}, dt);
-         edges.addEdge(ct::LineSeg2<T>{v, dt[i == 2 ? 0 : i + 1]}, dt);
-      }
+      const auto site = static_cast<std::uint32_t>(i);
+      builder.build(site, outline);
+      if (outline.vertices.empty())
+         continue;
+
+      Poly2<T> voronoiPoly = internals::clipOutline(outline, border);
+      if (voronoiPoly.size() > 0)
+         tiles.emplace_back(builder.site(site), std::move(voronoiPoly));
    }
+}
+
+
+template <typename T>
+IndexedTriangulation<T> VoronoiTesselation<T>::delauneyTriangulation()
+{
+   // Bowyer-Watson is faster on a single thread.
+   const DelauneyAlgorithm algorithm = m_numThreads > 1
+                                          ? DelauneyAlgorithm::DivideAndConquer
+                                          : DelauneyAlgorithm::BowyerWatson;
+   DelauneyTriangulation delauney{m_samples, algorithm, m_numThreads};
+   IndexedTriangulation<T> triangulation = delauney.triangulateIndexed(true);
+
+   m_triangulation.clear();
+   m_triangulation.reserve(triangulation.numTriangles());
+   for (std::size_t i = 0; i < triangulation.numTriangles(); ++i)
+      m_triangulation.push_back(triangulation.triangle(i));
 
-   return edgeMap;
+   return triangulation;
 }
 
 } // namespace geom
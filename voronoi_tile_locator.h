@@ -0,0 +1,171 @@
+//
+// geomcpp
+// Queries for the Voronoi tile that owns a point.
+//
+// Oct-2026, Michael Lindner
+// MIT license
+//
+#pragma once
+#include "delauney_point_locator.h"
+#include "delauney_triangulation.h"
+#include "indexed_triangulation.h"
+#include "point2.h"
+#include "voronoi_tile.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace geom
+{
+///////////////////
+
+// Finds the Voronoi tile that owns a point, i.e. the tile whose seed is closest
+// to the point.
+// - The seeds of the tiles are triangulated. The locator jumps to a triangle
+//   close to a point and walks through the Delauney mesh to the nearest seed.
+//   This takes expected O(1) time per query instead of testing the point
+//   against the outlines of the tiles.
+// - Points outside of the border of the tesselation are assigned to the tile
+//   with the closest seed, too.
+// - Collinear seeds or less than three seeds can't be triangulated. Queries for
+//   them check all seeds.
+// Queries don't modify the locator, so any number of threads can query the
+// same locator concurrently. Batched queries can also split their points
+// across multiple threads themselves.
+template <typename T> class VoronoiTileLocator
+{
+ public:
+   using Idx = std::uint32_t;
+   // Result for locators without tiles.
+   static constexpr Idx NoIdx = std::numeric_limits<Idx>::max();
+
+   // Builds the search structures for given tiles. The seeds of the tiles have
+   // to be unique, which they are for the tiles of a tesselation.
+   explicit VoronoiTileLocator(const std::vector<VoronoiTile<T>>& tiles);
+
+   // Returns the index of the tile that owns a given point.
+   Idx findTile(const Point2<T>& pt) const;
+   // Batched version of the query. Stores the tile index for each point at the
+   // same position in a given result vector. The result does not depend on the
+   // number of threads.
+   void findTiles(const std::vector<Point2<T>>& points, std::vector<Idx>& result,
+                  std::size_t numThreads = 1) const;
+
+ private:
+   static std::vector<Point2<T>> collectSeeds(const std::vector<VoronoiTile<T>>& tiles);
+   void mapVerticesToTiles();
+   // Finds the tile that owns a given point by checking all seeds.
+   Idx findTileByScan(const Point2<T>& pt) const;
+
+ private:
+   std::vector<Point2<T>> m_seeds;
+   DelauneyPointLocator<T> m_locator;
+   // Tile of each vertex of the triangulation.
+   std::vector<Idx> m_vertexTiles;
+};
+
+
+template <typename T>
+VoronoiTileLocator<T>::VoronoiTileLocator(const std::vector<VoronoiTile<T>>& tiles)
+: m_seeds{collectSeeds(tiles)},
+  m_locator{DelauneyTriangulation<T>{m_seeds}.triangulateIndexed(true)}
+{
+   assert(m_seeds.size() < NoIdx);
+   mapVerticesToTiles();
+}
+
+
+template <typename T>
+typename VoronoiTileLocator<T>::Idx
+VoronoiTileLocator<T>::findTile(const Point2<T>& pt) const
+{
+   const Idx vertex = m_locator.nearestVertex(pt);
+   return vertex != DelauneyPointLocator<T>::NoIdx ? m_vertexTiles[vertex]
+                                                   : findTileByScan(pt);
+}
+
+
+template <typename T>
+void VoronoiTileLocator<T>::findTiles(const std::vector<Point2<T>>& points,
+                                      std::vector<Idx>& result,
+                                      std::size_t numThreads) const
+{
+   if (m_locator.triangulation().numTriangles() == 0)
+   {
+      result.resize(points.size());
+      for (std::size_t i = 0; i < points.size(); ++i)
+         result[i] = findTileByScan(points[i]);
+      return;
+   }
+
+   m_locator.nearestVertex(points, result, numThreads);
+   for (Idx& idx : result)
+      idx = m_vertexTiles[idx];
+}
+
+
+template <typename T>
+std::vector<Point2<T>>
+VoronoiTileLocator<T>::collectSeeds(const std::vector<VoronoiTile<T>>& tiles)
+{
+   std::vector<Point2<T>> seeds;
+   seeds.reserve(tiles.size());
+   for (const auto& tile : tiles)
+      seeds.push_back(tile.seed());
+   return seeds;
+}
+
+
+template <typename T> void VoronoiTileLocator<T>::mapVerticesToTiles()
+{
+   // The triangulation reorders its vertices. Its vertices are copies of the
+   // seeds, so they can be matched exactly.
+   const auto lessXY = [](const Point2<T>& a, const Point2<T>& b) {
+      return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+   };
+
+   std::vector<Idx> sortedTiles(m_seeds.size());
+   for (Idx i = 0; i < sortedTiles.size(); ++i)
+      sortedTiles[i] = i;
+   std::sort(sortedTiles.begin(), sortedTiles.end(), [&](Idx a, Idx b) {
+      return lessXY(m_seeds[a], m_seeds[b]);
+   });
+
+   const std::vector<Point2<T>>& vertices = m_locator.triangulation().vertices;
+   m_vertexTiles.resize(vertices.size());
+   for (std::size_t v = 0; v < vertices.size(); ++v)
+   {
+      const auto pos = std::lower_bound(
+         sortedTiles.begin(), sortedTiles.end(), vertices[v],
+         [&](Idx tile, const Point2<T>& pt) { return lessXY(m_seeds[tile], pt); });
+      assert(pos != sortedTiles.end());
+      m_vertexTiles[v] = *pos;
+   }
+}
+
+
+template <typename T>
+typename VoronoiTileLocator<T>::Idx
+VoronoiTileLocator<T>::findTileByScan(const Point2<T>& pt) const
+{
+   Idx nearest = NoIdx;
+   T nearestDist = T(0);
+   for (Idx i = 0; i < m_seeds.size(); ++i)
+   {
+      const T dx = m_seeds[i].x() - pt.x();
+      const T dy = m_seeds[i].y() - pt.y();
+      const T dist = dx * dx + dy * dy;
+      if (nearest == NoIdx || dist < nearestDist)
+      {
+         nearest = i;
+         nearestDist = dist;
+      }
+   }
+   return nearest;
+}
+
+} // namespace geom